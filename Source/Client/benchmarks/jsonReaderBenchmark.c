@@ -0,0 +1,170 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+/*
+ * Micro-benchmark: lectura del mensaje `sendGameState` en el espectador con cJSON (árbol completo y
+ * `cJSON_GetArrayItem` por ladrillo, como lo hacía `updateGameStateFromJson`) contra el lector en flujo
+ * (`read_GameState_json`) para tableros de 8x8, 20x20 y 64x64. Al final verifica que ambas lecturas
+ * coincidan con el estado original.
+ *
+ * Uso:
+ *   ./JsonReaderBenchmark [iteraciones]
+ */
+
+// BIBLIOTECAS DE PROYECTO
+#include "../game/stateJson.h"
+#include "../comunicaciones/jsonWriter.h"
+#include "../game/Objects/brick.h"
+#include "../game/Objects/ball.h"
+#include "../game/ballKernel.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <cjson/cJSON.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCHMARK_DEFAULT_ITERATIONS 2000
+#define BENCHMARK_MAX_BALLS 5
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static GameState *createBoard(int rows, int cols, bool filled) {
+    GameState *gameState = calloc(1, sizeof(GameState));
+    gameState->linesOfBricks = rows;
+    gameState->bricksPerLine = cols;
+    gameState->maxBalls = BENCHMARK_MAX_BALLS;
+    ball_pool_alloc(&gameState->balls, BENCHMARK_MAX_BALLS);
+    brick_grid_alloc(&gameState->bricks, rows, cols);
+    if (!filled) {
+        return gameState;
+    }
+
+    gameState->player = (Player){ { 400.5f, 393.75f }, { 80, 10 }, 3, 12345, false, false };
+    gameState->levelsCompleted = 2;
+    for (int b = 0; b < BENCHMARK_MAX_BALLS; b++) {
+        ball_set_active(&gameState->balls, b, b < 2);
+        ball_set_position(&gameState->balls, b, (Vector2){ 100.25f + b * 37.3f, 200.0f - b * 11.7f });
+    }
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            brick_set_active(&gameState->bricks, i, j, ((i * cols + j) % 3) != 0);
+        }
+    }
+    return gameState;
+}
+
+static void destroyBoard(GameState *gameState) {
+    brick_grid_free(&gameState->bricks);
+    ball_pool_free(&gameState->balls);
+    free(gameState);
+}
+
+// Lectura anterior del espectador: árbol de cJSON y un recorrido desde el inicio por cada ladrillo
+static bool readWithCJSON(const char *json, GameState *gameState) {
+    cJSON *root = cJSON_Parse(json);
+    if (root == NULL) return false;
+
+    cJSON *player = cJSON_GetObjectItem(root, "player");
+    gameState->player.position.x = cJSON_GetObjectItem(player, "positionX")->valueint;
+    gameState->player.position.y = cJSON_GetObjectItem(player, "positionY")->valueint;
+    gameState->player.size.x = cJSON_GetObjectItem(player, "sizeX")->valueint;
+    gameState->player.size.y = cJSON_GetObjectItem(player, "sizeY")->valueint;
+    gameState->player.life = cJSON_GetObjectItem(player, "lives")->valueint;
+    gameState->player.score = cJSON_GetObjectItem(player, "score")->valueint;
+
+    cJSON *balls = cJSON_GetObjectItem(root, "balls");
+    for (int i = 0; i < cJSON_GetArraySize(balls) && i < gameState->maxBalls; i++) {
+        cJSON *ball = cJSON_GetArrayItem(balls, i);
+        ball_set_active(&gameState->balls, i, cJSON_GetObjectItem(ball, "active")->valueint);
+        gameState->balls.x[i] = cJSON_GetObjectItem(ball, "positionX")->valueint;
+        gameState->balls.y[i] = cJSON_GetObjectItem(ball, "positionY")->valueint;
+    }
+
+    cJSON *bricks = cJSON_GetObjectItem(root, "bricks");
+    for (int i = 0; i < cJSON_GetArraySize(bricks); i++) {
+        cJSON *brick = cJSON_GetArrayItem(bricks, i);
+        brick_set_active(&gameState->bricks, i / gameState->bricksPerLine, i % gameState->bricksPerLine,
+                         cJSON_GetObjectItem(brick, "active")->valueint);
+    }
+
+    gameState->gameOver = cJSON_GetObjectItem(root, "gameOver")->valueint;
+    gameState->pause = cJSON_GetObjectItem(root, "paused")->valueint;
+    gameState->winner = cJSON_GetObjectItem(root, "winner")->valueint;
+    gameState->levelsCompleted = cJSON_GetObjectItem(root, "levelsCompleted")->valueint;
+    cJSON_Delete(root);
+    return true;
+}
+
+// Ladrillos, bolas activas y marcador iguales a los del original
+static bool sameState(const GameState *a, const GameState *b) {
+    int words = a->bricks.rows * a->bricks.wordsPerRow;
+    return memcmp(a->bricks.active, b->bricks.active, (size_t)words * sizeof(uint64_t)) == 0
+           && a->balls.active[0] == b->balls.active[0]
+           && a->player.score == b->player.score
+           && a->player.life == b->player.life
+           && a->levelsCompleted == b->levelsCompleted;
+}
+
+static void runCase(int rows, int cols, int iterations) {
+    GameState *original = createBoard(rows, cols, true);
+    GameState *received = createBoard(rows, cols, false);
+
+    JsonWriter *writer = JsonWriter_threadInstance();
+    JsonWriter_reset(writer);
+    write_GameState_json(writer, original);
+    const char *json = writer->data;
+    size_t length = writer->length;
+
+    double start = nowSeconds();
+    bool cjsonOk = true;
+    for (int k = 0; k < iterations; k++) {
+        cjsonOk &= readWithCJSON(json, received);
+    }
+    double cjsonSeconds = nowSeconds() - start;
+    cjsonOk &= sameState(original, received);
+
+    destroyBoard(received);
+    received = createBoard(rows, cols, false);
+
+    start = nowSeconds();
+    bool readerOk = true;
+    for (int k = 0; k < iterations; k++) {
+        readerOk &= read_GameState_json(json, length, received);
+    }
+    double readerSeconds = nowSeconds() - start;
+    readerOk &= sameState(original, received);
+
+    printf("%3dx%-3d  cJSON: %9.0f ns/msg%s   JsonReader: %9.0f ns/msg%s   (%6zu bytes)   x%.1f\n",
+           rows, cols,
+           cjsonSeconds * 1e9 / iterations, cjsonOk ? "" : " (ERROR)",
+           readerSeconds * 1e9 / iterations, readerOk ? "" : " (ERROR)",
+           length, readerSeconds > 0 ? cjsonSeconds / readerSeconds : 0.0);
+
+    destroyBoard(received);
+    destroyBoard(original);
+}
+
+int main(int argc, char **argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : BENCHMARK_DEFAULT_ITERATIONS;
+    if (iterations <= 0) iterations = BENCHMARK_DEFAULT_ITERATIONS;
+
+    printf("Lectura de sendGameState, %d iteraciones por caso\n", iterations);
+    runCase(8, 8, iterations);
+    runCase(20, 20, iterations);
+    runCase(64, 64, iterations);
+    return 0;
+}
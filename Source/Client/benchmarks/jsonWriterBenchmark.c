@@ -0,0 +1,112 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+/*
+ * Micro-benchmark: serialización del estado del juego con cJSON (`generate_GameState_json`)
+ * contra el escritor en flujo (`write_GameState_json`) para tableros de 8x8, 20x20 y 64x64.
+ *
+ * Uso:
+ *   ./JsonWriterBenchmark [iteraciones]
+ */
+
+// BIBLIOTECAS DE PROYECTO
+#include "../game/stateJson.h"
+#include "../comunicaciones/jsonWriter.h"
+#include "../game/Objects/brick.h"
+#include "../game/Objects/ball.h"
+#include "../game/ballKernel.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCHMARK_DEFAULT_ITERATIONS 20000
+#define BENCHMARK_MAX_BALLS 5
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static GameState *createBoard(int rows, int cols) {
+    GameState *gameState = calloc(1, sizeof(GameState));
+    gameState->linesOfBricks = rows;
+    gameState->bricksPerLine = cols;
+    gameState->maxBalls = BENCHMARK_MAX_BALLS;
+    gameState->player = (Player){ { 400.5f, 393.75f }, { 80, 10 }, 3, 12345, false, false };
+
+    ball_pool_alloc(&gameState->balls, BENCHMARK_MAX_BALLS);
+    for (int b = 0; b < BENCHMARK_MAX_BALLS; b++) {
+        ball_set_active(&gameState->balls, b, b < 2);
+        ball_set_position(&gameState->balls, b, (Vector2){ 100.25f + b * 37.3f, 200.0f - b * 11.7f });
+    }
+
+    brick_grid_alloc(&gameState->bricks, rows, cols);
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            brick_set_active(&gameState->bricks, i, j, ((i * cols + j) % 3) != 0);
+        }
+    }
+    return gameState;
+}
+
+static void destroyBoard(GameState *gameState) {
+    brick_grid_free(&gameState->bricks);
+    ball_pool_free(&gameState->balls);
+    free(gameState);
+}
+
+static void runCase(int rows, int cols, int iterations) {
+    GameState *gameState = createBoard(rows, cols);
+    size_t cjsonBytes = 0;
+    size_t writerBytes = 0;
+
+    // Ruta con cJSON: nodos por ladrillo + cadena nueva en cada mensaje
+    double start = nowSeconds();
+    for (int k = 0; k < iterations; k++) {
+        char *json = generate_GameState_json(gameState);
+        cjsonBytes = strlen(json);
+        free(json);
+    }
+    double cjsonSeconds = nowSeconds() - start;
+
+    // Ruta con el escritor en flujo: mismo buffer en todas las iteraciones
+    JsonWriter *writer = JsonWriter_threadInstance();
+    start = nowSeconds();
+    for (int k = 0; k < iterations; k++) {
+        JsonWriter_reset(writer);
+        write_GameState_json(writer, gameState);
+        writerBytes = writer->length;
+    }
+    double writerSeconds = nowSeconds() - start;
+
+    printf("%3dx%-3d  cJSON: %9.0f ns/msg (%6zu bytes)   JsonWriter: %9.0f ns/msg (%6zu bytes)   x%.1f\n",
+           rows, cols,
+           cjsonSeconds * 1e9 / iterations, cjsonBytes,
+           writerSeconds * 1e9 / iterations, writerBytes,
+           writerSeconds > 0 ? cjsonSeconds / writerSeconds : 0.0);
+
+    destroyBoard(gameState);
+}
+
+int main(int argc, char **argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : BENCHMARK_DEFAULT_ITERATIONS;
+    if (iterations <= 0) iterations = BENCHMARK_DEFAULT_ITERATIONS;
+
+    printf("Serialización de sendGameState, %d iteraciones por caso\n", iterations);
+    runCase(8, 8, iterations);
+    runCase(20, 20, iterations);
+    runCase(64, 64, iterations);
+    return 0;
+}
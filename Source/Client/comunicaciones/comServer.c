@@ -12,6 +12,7 @@ Consulta el archivo LICENSE para más detalles.
 
 // BIBLIOTECAS EXTERNAS
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <log.h>
 
@@ -22,11 +23,14 @@ Consulta el archivo LICENSE para más detalles.
 // Puntero estático para almacenar la única instancia de ComServer
 static ComServer *comserver_instance = NULL;
 
+static void ComServer_onData(void *context, char *data, size_t length);
+
 /* Function: ComServer_create
    Descripción:
      Crea e inicializa una instancia única del servidor de comunicaciones (`ComServer`). Configura sus
      componentes principales como el servidor de sockets y el procesador de JSON. Si ya existe una
-     instancia, retorna la existente.
+     instancia, retorna la existente. El reactor de red no se inicia aquí sino en `ComServer_start`,
+     después de registrar el callback; los mensajes enviados antes quedan en cola.
 
    Params:
      (Ninguno)
@@ -68,15 +72,20 @@ ComServer *ComServer_create() {
 
     comserver_instance->socketServer = SocketServer_create();
     comserver_instance->jsonProcessor = JsonProcessor_create();
-    comserver_instance->onMessageReceived = NULL;  // Callback inicializado a NULL
+    atomic_init(&comserver_instance->onMessageReceived, NULL);  // Callback inicializado a NULL
+    comserver_instance->reactor = NULL;
+
+    if (comserver_instance->socketServer != NULL) {
+        comserver_instance->reactor = NetReactor_create(comserver_instance->socketServer, FRAME_MODE_NEWLINE,
+                                                        ComServer_onData, comserver_instance);
+    }
 
-    if (comserver_instance->socketServer == NULL || comserver_instance->jsonProcessor == NULL) {
+    if (comserver_instance->socketServer == NULL || comserver_instance->jsonProcessor == NULL
+        || comserver_instance->reactor == NULL) {
         ComServer_destroy(comserver_instance);
         return NULL;
     }
 
-    SocketServer_start(comserver_instance->socketServer);
-
     return comserver_instance;
 }
 
@@ -109,6 +118,7 @@ ComServer *ComServer_create() {
 */
 void ComServer_destroy(ComServer *server) {
     if (server != NULL) {
+        NetReactor_destroy(server->reactor);
         SocketServer_destroy(server->socketServer);
         JsonProcessor_destroy(server->jsonProcessor);
         free(server);
@@ -139,7 +149,7 @@ void ComServer_destroy(ComServer *server) {
    Problems:
      - Problema: Si `server` es `NULL`, no se podrá enviar el mensaje.
        - Solución: Registrar una advertencia con `savelog_warn` y evitar operaciones adicionales.
-     - Problema: Si `JsonProcessor_createJsonMessage` o `SocketServer_send` fallan, el mensaje no se enviará.
+     - Problema: Si `JsonProcessor_createJsonMessage` o `NetReactor_send` fallan, el mensaje no se enviará.
        - Solución: Manejar errores apropiadamente y registrar los mensajes.
 
    References:
@@ -153,7 +163,7 @@ void ComServer_sendMessage(ComServer *server, const char *message) {
 
     char *jsonMessage = JsonProcessor_createJsonMessage(server->jsonProcessor, message);
     savelog_info(jsonMessage);
-    SocketServer_send(server->socketServer, jsonMessage);
+    NetReactor_send(server->reactor, jsonMessage, strlen(jsonMessage));
     free(jsonMessage);
 }
 
@@ -193,7 +203,7 @@ void ComServer_sendPlayerName(ComServer *server, const char *name) {
     }
 
     char *jsonMessage = JsonProcessor_createJsonPlayerName(server->jsonProcessor, name);
-    SocketServer_send(server->socketServer, jsonMessage);
+    NetReactor_send(server->reactor, jsonMessage, strlen(jsonMessage));
     free(jsonMessage);
 }
 
@@ -231,7 +241,7 @@ void ComServer_observerGetlist(ComServer *server) {
     }
 
     char *jsonMessage = JsonProcessor_createJsonGetListPlayers(server->jsonProcessor);
-    SocketServer_send(server->socketServer, jsonMessage);
+    NetReactor_send(server->reactor, jsonMessage, strlen(jsonMessage));
     free(jsonMessage);
 }
 
@@ -271,7 +281,7 @@ void comServer_sendChoosenPlayer(ComServer *server,const char *playerId) {
         }
 
         char *jsonMessage = JsonProcessor_createJsonChoosenPlayer(server->jsonProcessor,playerId);
-        SocketServer_send(server->socketServer, jsonMessage);
+        NetReactor_send(server->reactor, jsonMessage, strlen(jsonMessage));
         free(jsonMessage);
 
 }
@@ -297,7 +307,7 @@ void comServer_sendChoosenPlayer(ComServer *server,const char *playerId) {
    Problems:
      - Problema: Si `comserver_instance` es `NULL`, no se puede enviar el mensaje.
        - Solución: Registrar una advertencia con `savelog_warn` y evitar operaciones adicionales.
-     - Problema: Si `message` es nulo o inválido, puede ocurrir un error en `SocketServer_send`.
+     - Problema: Si `message` es nulo o inválido, puede ocurrir un error en `NetReactor_send`.
        - Solución: Validar `message` antes de procesarlo.
 
    References:
@@ -310,13 +320,46 @@ void ComServer_sendStatus(const char *message) {
         savelog_warn("Servidor no inicializado.\n");
         return;
     }
-    SocketServer_send(comserver_instance->socketServer, message);
+    NetReactor_send(comserver_instance->reactor, message, strlen(message));
     free(message);
 }
 
+/* Function: ComServer_sendBuffer
+   Descripción:
+     Envía un mensaje de estado sin liberarlo. Se usa con buffers reutilizables, como el de `JsonWriter`.
+
+   Params:
+     message - Cadena de texto que contiene el mensaje a enviar; sigue siendo propiedad del llamador.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - El servidor debe estar correctamente inicializado mediante `ComServer_create`.
+
+   Example:
+     ComServer_sendBuffer(writer->data);
+
+   Problems:
+     - Problema: Si `comserver_instance` es `NULL`, no se puede enviar el mensaje.
+       - Solución: Registrar una advertencia con `savelog_warn` y evitar operaciones adicionales.
+
+   References:
+     - Ninguna referencia externa específica.
+*/
+void ComServer_sendBuffer(const char *message) {
+    if (comserver_instance == NULL) {
+        savelog_warn("Servidor no inicializado.\n");
+        return;
+    }
+    NetReactor_send(comserver_instance->reactor, message, strlen(message));
+}
+
 /* Function: ComServer_registerCallback
    Descripción:
-     Registra un callback para manejar mensajes recibidos por el servidor de comunicaciones.
+     Registra un callback para manejar mensajes recibidos por el servidor de comunicaciones. Se puede
+     cambiar en cualquier momento (cada pantalla registra el suyo): el hilo del reactor lo lee de forma
+     atómica antes de entregar cada mensaje.
 
    Params:
      server - Puntero al servidor de comunicaciones (`ComServer *`) donde se registrará el callback.
@@ -344,66 +387,75 @@ void ComServer_sendStatus(const char *message) {
 */
 void ComServer_registerCallback(ComServer *server, MessageReceivedCallback callback) {
     if (server != NULL) {
-        printf("Se registro el callback corectamente\n");
-        server->onMessageReceived = callback;
+        log_debug("Se registro el callback corectamente\n");
+        atomic_store_explicit(&server->onMessageReceived, callback, memory_order_release);
     }
     else {
-        printf("UPS, no se puedo registrar el callback");
+        log_warn("UPS, no se puedo registrar el callback\n");
     }
 }
 
-/* Function: ComServer_messageListeningLoop
+/* Function: ComServer_onData
    Descripción:
-     Ejecuta un bucle continuo para recibir mensajes del servidor a través del socket. Cuando se recibe un
-     mensaje, lo pasa al callback registrado (`onMessageReceived`) si está definido.
+     Recibe cada mensaje completo reensamblado por el reactor de red y lo pasa al callback registrado
+     (`onMessageReceived`). Aunque TCP junte o parta los mensajes, el callback recibe exactamente una línea.
 
    Params:
-     arg - Puntero a la instancia del servidor de comunicaciones (`ComServer *`).
+     context - Puntero a la instancia del servidor de comunicaciones (`ComServer *`).
+     data - Mensaje recibido sin el '\n', terminado en '\0'.
+     length - Longitud del mensaje.
 
    Returns:
-     - void*: Retorna `NULL` en caso de error durante la inicialización del servidor.
+     - void: No retorna valores.
 
    Restriction:
-     - `arg` debe ser un puntero válido a una instancia inicializada de `ComServer`.
-     - El callback `onMessageReceived` debe estar configurado si se desea procesar los mensajes.
+     - Se ejecuta en el hilo del reactor; el callback no debe bloquearse por mucho tiempo.
+*/
+static void ComServer_onData(void *context, char *data, size_t length) {
+    ComServer *server = (ComServer *)context;
+    (void)length;
+    MessageReceivedCallback callback = atomic_load_explicit(&server->onMessageReceived, memory_order_acquire);
+    if (callback != NULL) {
+        callback(data);  // Notificar al observer
+    } else {
+        log_warn("Mensaje descartado: no hay callback registrado\n");
+    }
+}
+
+/* Function: ComServer_start
+   Descripción:
+     Asegura que el reactor de red esté corriendo. El reactor es el único hilo que usa el socket: se conecta
+     (y reconecta) por su cuenta, envía los mensajes encolados y entrega los recibidos al callback registrado.
+     Llamarla varias veces no crea hilos adicionales. Debe llamarse después de `ComServer_registerCallback`,
+     para que ningún mensaje llegue sin callback.
+
+   Params:
+     server - Puntero a la instancia del servidor de comunicaciones (`ComServer *`).
+
+   Returns:
+     - bool: `true` si el reactor está corriendo.
+
+   Restriction:
+     - `server` debe haberse creado con `ComServer_create`.
 
    Example:
-     pthread_t listenerThread;
-     pthread_create(&listenerThread, NULL, ComServer_messageListeningLoop, (void *)server);
-     // Inicia un hilo para escuchar mensajes del servidor.
+     ComServer *server = ComServer_create();
+     ComServer_registerCallback(server, callback);
+     ComServer_start(server);
 
    Problems:
-     - Problema: Si `arg` es `NULL`, no se puede inicializar el bucle de escucha.
-       - Solución: Registrar un mensaje de error con `savelog_error` y retornar `NULL`.
-     - Problema: Si el servidor pierde la conexión, puede entrar en un estado de reconexión continua.
-       - Solución: Limitar los intentos de reconexión o implementar un tiempo de espera.
+     - Problema: Antes cada pantalla creaba su propio hilo de lectura sobre el mismo socket.
+       - Solución: El reactor es único por servidor y esta función sólo lo inicia si no estaba corriendo.
 
    References:
      - Ninguna referencia externa específica.
 */
-void *ComServer_messageListeningLoop(void *arg) {
-    ComServer *server = (ComServer *)arg;
+bool ComServer_start(ComServer *server) {
     if (server == NULL) {
         savelog_error("Servidor no inicializado para la escucha de mensajes.\n");
-        return NULL;
-    }
-
-    char buffer[4096];
-    while (1) {
-        if (server->socketServer->isConnected) {
-            int bytesReceived = SocketServer_receive(server->socketServer, buffer, sizeof(buffer));
-            if (bytesReceived > 0) {
-                if (server->onMessageReceived != NULL) {
-                    server->onMessageReceived(buffer);  // Notificar al observer
-                }
-                //free(processedMessage);
-            } else {
-                log_error("Error al recibir el mensaje del servidor\n");
-            }
-        } else {
-            SocketServer_reconnect(server->socketServer);
-        }
+        return false;
     }
+    return NetReactor_start(server->reactor);
 }
 
 /* Function: ComServer_handleReceivedMessage
@@ -12,8 +12,11 @@ Consulta el archivo LICENSE para más detalles.
 #define COM_SERVER_H
 
 #include "socketServer.h"
+#include "netReactor.h"
 #include "jsonProcessor.h"
 
+#include <stdatomic.h>
+
 
 // Definición del callback que será llamado cuando se reciba un nuevo mensaje
 typedef void (*MessageReceivedCallback)(const char *message);
@@ -22,8 +25,9 @@ typedef struct {
     // Estructura interna para manejar los datos de comunicación
     int isRunning;  // Para saber si el servidor está corriendo
     SocketServer *socketServer;  // Puntero a la estructura de SocketServer
+    NetReactor *reactor;  // Hilo de red dueño del socket
     JsonProcessor *jsonProcessor;  // Puntero a la estructura de JsonProcessor
-    MessageReceivedCallback onMessageReceived;  // Función callback
+    _Atomic(MessageReceivedCallback) onMessageReceived;  // Función callback; la lee el hilo del reactor
 } ComServer;
 
 // Constructor y Destructor
@@ -31,16 +35,14 @@ ComServer *ComServer_create();
 void ComServer_destroy(ComServer *server);
 
 // Métodos de la clase
-void ComServer_start(ComServer *server);
-char *ComServer_getProcessedMessage(ComServer *server);
-void ComServer_processIncomingMessage(ComServer *server, const char *message);
+bool ComServer_start(ComServer *server);
 
 // Métodos para enviar y recibir mensajes
 void ComServer_sendMessage(ComServer *server, const char *message);
 void ComServer_sendStatus(const char *message);
+void ComServer_sendBuffer(const char *message);
 void ComServer_sendPlayerName(ComServer *server, const char *message);
 void ComServer_registerCallback(ComServer *server, MessageReceivedCallback callback);
-void *ComServer_messageListeningLoop(void *arg);
 void ComServer_observerGetlist(ComServer *server);
 void comServer_sendChoosenPlayer(ComServer *server,const char *player);
 
@@ -0,0 +1,340 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "frameReader.h"
+#include "../logs/saveLog.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+#include <log.h>
+
+// ============================================================================================================= //
+// BUFFER CIRCULAR
+
+static size_t mask(const FrameReader *reader, size_t position) {
+    return position & (reader->capacity - 1);
+}
+
+static size_t used_bytes(const FrameReader *reader) {
+    return reader->writePos - reader->readPos;
+}
+
+// Copia `length` bytes desde la posición absoluta `from` aunque den la vuelta al buffer
+static void copy_out(const FrameReader *reader, size_t from, size_t length, char *destination) {
+    size_t index = mask(reader, from);
+    size_t first = reader->capacity - index;
+    if (first > length) first = length;
+    memcpy(destination, reader->ring + index, first);
+    memcpy(destination + first, reader->ring, length - first);
+}
+
+// Busca '\n' en [from, to) recorriendo como mucho dos tramos contiguos
+static bool find_delimiter(const FrameReader *reader, size_t from, size_t to, size_t *found) {
+    while (from < to) {
+        size_t index = mask(reader, from);
+        size_t chunk = reader->capacity - index;
+        if (chunk > to - from) chunk = to - from;
+
+        const char *hit = memchr(reader->ring + index, '\n', chunk);
+        if (hit != NULL) {
+            *found = from + (size_t)(hit - (reader->ring + index));
+            return true;
+        }
+        from += chunk;
+    }
+    return false;
+}
+
+// Duplica la capacidad dejando los datos pendientes al inicio del buffer nuevo
+static bool grow(FrameReader *reader) {
+    size_t limit = reader->maxFrame + FRAME_READER_LENGTH_HEADER + 1;
+    if (reader->capacity >= limit) return false;
+
+    size_t capacity = reader->capacity * 2;
+    char *ring = malloc(capacity);
+    if (ring == NULL) {
+        savelog_error("Error al ampliar el buffer de recepción\n");
+        return false;
+    }
+
+    size_t used = used_bytes(reader);
+    copy_out(reader, reader->readPos, used, ring);
+    free(reader->ring);
+
+    reader->scanPos -= reader->readPos;
+    reader->readPos = 0;
+    reader->writePos = used;
+    reader->ring = ring;
+    reader->capacity = capacity;
+    return true;
+}
+
+static char *scratch_copy(FrameReader *reader, size_t from, size_t length) {
+    if (length + 1 > reader->scratchCapacity) {
+        char *scratch = realloc(reader->scratch, length + 1);
+        if (scratch == NULL) {
+            savelog_error("Error al reservar memoria para reensamblar un mensaje\n");
+            return NULL;
+        }
+        reader->scratch = scratch;
+        reader->scratchCapacity = length + 1;
+    }
+    copy_out(reader, from, length, reader->scratch);
+    reader->scratch[length] = '\0';
+    return reader->scratch;
+}
+
+// ============================================================================================================= //
+// MODOS
+
+static bool next_line(FrameReader *reader, char **frame, size_t *length) {
+    for (;;) {
+        size_t delimiter;
+        bool found = find_delimiter(reader, reader->scanPos, reader->writePos, &delimiter);
+
+        if (reader->discarding) {
+            reader->readPos = reader->scanPos = found ? delimiter + 1 : reader->writePos;
+            if (!found) return false;
+            reader->discarding = false;
+            continue;
+        }
+
+        if (!found) {
+            reader->scanPos = reader->writePos;
+            if (used_bytes(reader) > reader->maxFrame) {
+                log_warn("Mensaje de más de %zu bytes descartado\n", reader->maxFrame);
+                reader->readPos = reader->writePos;
+                reader->discarding = true;
+            }
+            return false;
+        }
+
+        size_t start = reader->readPos;
+        size_t size = delimiter - start;
+        reader->readPos = reader->scanPos = delimiter + 1;
+
+        if (size > 0 && reader->ring[mask(reader, delimiter - 1)] == '\r') size--;
+        if (size == 0) continue;  // Líneas vacías
+        if (size > reader->maxFrame) {
+            log_warn("Mensaje de %zu bytes descartado\n", size);
+            continue;
+        }
+
+        if (mask(reader, start) + size < reader->capacity) {
+            // Contiguo: el terminador reemplaza al delimitador dentro del mismo buffer
+            reader->ring[mask(reader, start + size)] = '\0';
+            *frame = reader->ring + mask(reader, start);
+        } else {
+            *frame = scratch_copy(reader, start, size);
+            if (*frame == NULL) continue;
+        }
+        *length = size;
+        return true;
+    }
+}
+
+static bool next_prefixed(FrameReader *reader, char **frame, size_t *length) {
+    for (;;) {
+        if (reader->discard > 0) {
+            size_t skip = used_bytes(reader) < reader->discard ? used_bytes(reader) : reader->discard;
+            reader->readPos += skip;
+            reader->discard -= skip;
+            if (reader->discard > 0) return false;
+        }
+
+        if (used_bytes(reader) < FRAME_READER_LENGTH_HEADER) return false;
+
+        unsigned char header[FRAME_READER_LENGTH_HEADER];
+        copy_out(reader, reader->readPos, sizeof(header), (char *)header);
+        size_t size = ((size_t)header[0] << 24) | ((size_t)header[1] << 16) | ((size_t)header[2] << 8) | header[3];
+
+        if (size > reader->maxFrame) {
+            log_warn("Mensaje de %zu bytes descartado\n", size);
+            reader->discard = FRAME_READER_LENGTH_HEADER + size;
+            continue;
+        }
+        if (used_bytes(reader) < FRAME_READER_LENGTH_HEADER + size) return false;
+
+        size_t start = reader->readPos + FRAME_READER_LENGTH_HEADER;
+        reader->readPos = start + size;
+
+        if (mask(reader, start) + size <= reader->capacity) {
+            *frame = reader->ring + mask(reader, start);
+        } else {
+            *frame = scratch_copy(reader, start, size);
+            if (*frame == NULL) continue;
+        }
+        *length = size;
+        return true;
+    }
+}
+
+// ============================================================================================================= //
+// API
+
+/* Function: FrameReader_create
+   Descripción:
+     Crea un lector de mensajes con un buffer circular de `FRAME_READER_INITIAL_CAPACITY` bytes que crece
+     hasta poder contener un mensaje de `maxFrame` bytes.
+
+   Params:
+     mode - Forma de delimitar los mensajes (`FRAME_MODE_NEWLINE` o `FRAME_MODE_LENGTH_PREFIXED`).
+     maxFrame - Tamaño máximo aceptado para un mensaje; 0 usa `FRAME_READER_MAX_FRAME`.
+
+   Returns:
+     - FrameReader*: Lector creado o `NULL` si no hay memoria.
+
+   Example:
+     FrameReader *reader = FrameReader_create(FRAME_MODE_NEWLINE, 0);
+*/
+FrameReader *FrameReader_create(FrameMode mode, size_t maxFrame) {
+    FrameReader *reader = calloc(1, sizeof(FrameReader));
+    if (reader == NULL) {
+        savelog_error("Error al asignar memoria para FrameReader\n");
+        return NULL;
+    }
+
+    reader->mode = mode;
+    reader->maxFrame = maxFrame > 0 ? maxFrame : FRAME_READER_MAX_FRAME;
+    reader->capacity = FRAME_READER_INITIAL_CAPACITY;
+    reader->ring = malloc(reader->capacity);
+    if (reader->ring == NULL) {
+        savelog_error("Error al asignar memoria para FrameReader\n");
+        free(reader);
+        return NULL;
+    }
+    return reader;
+}
+
+/* Function: FrameReader_destroy
+   Descripción:
+     Libera el lector y sus buffers.
+
+   Params:
+     reader - Lector a liberar; puede ser `NULL`.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void FrameReader_destroy(FrameReader *reader) {
+    if (reader == NULL) return;
+    free(reader->ring);
+    free(reader->scratch);
+    free(reader);
+}
+
+/* Function: FrameReader_writeRegions
+   Descripción:
+     Devuelve las regiones libres del buffer circular para que el socket escriba en ellas directamente
+     (por ejemplo con `readv`). Si el buffer está lleno lo amplía.
+
+   Params:
+     reader - Lector.
+     regions - Arreglo de dos regiones que se llena con el espacio libre, en orden.
+
+   Returns:
+     - int: Cantidad de regiones válidas (1 o 2), o 0 si no hay espacio.
+
+   Restriction:
+     - Debe llamarse después de consumir los mensajes con `FrameReader_next`; los punteros entregados
+       antes pueden quedar inválidos.
+
+   Example:
+     struct iovec regions[2];
+     int count = FrameReader_writeRegions(reader, regions);
+     ssize_t bytes = readv(fd, regions, count);
+     if (bytes > 0) FrameReader_commit(reader, bytes);
+*/
+int FrameReader_writeRegions(FrameReader *reader, struct iovec regions[2]) {
+    if (used_bytes(reader) == reader->capacity && !grow(reader)) {
+        return 0;
+    }
+
+    size_t space = reader->capacity - used_bytes(reader);
+    size_t index = mask(reader, reader->writePos);
+    size_t first = reader->capacity - index;
+    if (first > space) first = space;
+
+    regions[0].iov_base = reader->ring + index;
+    regions[0].iov_len = first;
+    if (first == space) return 1;
+
+    regions[1].iov_base = reader->ring;
+    regions[1].iov_len = space - first;
+    return 2;
+}
+
+/* Function: FrameReader_commit
+   Descripción:
+     Marca como escritos los primeros `bytes` bytes de las regiones devueltas por `FrameReader_writeRegions`.
+
+   Params:
+     reader - Lector.
+     bytes - Bytes recibidos.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void FrameReader_commit(FrameReader *reader, size_t bytes) {
+    reader->writePos += bytes;
+}
+
+/* Function: FrameReader_next
+   Descripción:
+     Entrega el siguiente mensaje completo del buffer, si lo hay.
+
+   Params:
+     reader - Lector.
+     frame - Recibe el puntero al contenido del mensaje.
+     length - Recibe la longitud del mensaje sin delimitador.
+
+   Returns:
+     - bool: `true` si se entregó un mensaje; `false` si falta recibir más datos.
+
+   Restriction:
+     - El puntero sólo es válido hasta la siguiente llamada a cualquier método del lector.
+
+   Example:
+     char *frame;
+     size_t length;
+     while (FrameReader_next(reader, &frame, &length)) {
+         procesar(frame, length);
+     }
+
+   Problems:
+     - Problema: Un mensaje malformado sin delimitador haría crecer el buffer sin límite.
+       - Solución: Los mensajes mayores a `maxFrame` se descartan hasta el siguiente delimitador.
+*/
+bool FrameReader_next(FrameReader *reader, char **frame, size_t *length) {
+    if (reader->mode == FRAME_MODE_LENGTH_PREFIXED) {
+        return next_prefixed(reader, frame, length);
+    }
+    return next_line(reader, frame, length);
+}
+
+/* Function: FrameReader_reset
+   Descripción:
+     Descarta los datos pendientes; se usa al perder la conexión para no mezclar un mensaje a medias
+     con los de la conexión nueva.
+
+   Params:
+     reader - Lector.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void FrameReader_reset(FrameReader *reader) {
+    reader->readPos = reader->writePos = reader->scanPos = 0;
+    reader->discard = 0;
+    reader->discarding = false;
+}
@@ -0,0 +1,68 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef FRAME_READER_H
+#define FRAME_READER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/uio.h>
+
+/*
+ * Header: Frame Reader
+ * Reensambla mensajes completos a partir del flujo TCP usando un buffer circular.
+ *
+ * El socket escribe directamente en el espacio libre del buffer (`FrameReader_writeRegions` +
+ * `FrameReader_commit`) y luego `FrameReader_next` entrega los mensajes completos de uno en uno.
+ * Si el mensaje está contiguo en el buffer se entrega un puntero al buffer mismo; sólo los mensajes
+ * que dan la vuelta al final del buffer se copian a un área auxiliar.
+ *
+ * Modos:
+ *   - FRAME_MODE_NEWLINE: mensajes separados por '\n' (protocolo JSON del servidor). El '\n' (y un
+ *     '\r' previo) se reemplaza por '\0', así que el mensaje se puede usar como cadena de C.
+ *   - FRAME_MODE_LENGTH_PREFIXED: cada mensaje va precedido por su longitud en 4 bytes big-endian.
+ *     El contenido es binario y no lleva terminador.
+ */
+
+#define FRAME_READER_INITIAL_CAPACITY 8192        // Potencia de dos
+#define FRAME_READER_MAX_FRAME (1024 * 1024)       // Mensajes más grandes se descartan
+#define FRAME_READER_LENGTH_HEADER 4
+
+typedef enum {
+    FRAME_MODE_NEWLINE,
+    FRAME_MODE_LENGTH_PREFIXED
+} FrameMode;
+
+typedef struct {
+    char *ring;
+    size_t capacity;   // Siempre potencia de dos
+    size_t readPos;    // Posiciones absolutas; el índice real es `pos & (capacity - 1)`
+    size_t writePos;
+    size_t scanPos;    // Hasta dónde ya se buscó el delimitador
+    size_t discard;    // Bytes pendientes de descartar de un mensaje demasiado grande
+    bool discarding;   // Modo newline: descartando hasta el próximo '\n'
+    FrameMode mode;
+    size_t maxFrame;
+
+    char *scratch;     // Copia lineal de los mensajes que dan la vuelta al buffer
+    size_t scratchCapacity;
+} FrameReader;
+
+// Constructor y Destructor
+FrameReader *FrameReader_create(FrameMode mode, size_t maxFrame);
+void FrameReader_destroy(FrameReader *reader);
+
+// Métodos de la clase
+int FrameReader_writeRegions(FrameReader *reader, struct iovec regions[2]);
+void FrameReader_commit(FrameReader *reader, size_t bytes);
+bool FrameReader_next(FrameReader *reader, char **frame, size_t *length);
+void FrameReader_reset(FrameReader *reader);
+
+#endif // FRAME_READER_H
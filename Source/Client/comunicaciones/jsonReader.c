@@ -0,0 +1,352 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "jsonReader.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdint.h>
+
+#define JSON_READER_MANTISSA_DIGITS 18  // Dígitos que caben en un int64 sin desbordar
+#define JSON_READER_MAX_EXPONENT 308
+#define JSON_READER_EXACT_POWERS 22     // 10^22 es la mayor potencia de 10 exacta en un double
+
+static const double powersOfTen[JSON_READER_EXACT_POWERS + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static bool fail(JsonReader *reader) {
+    reader->failed = true;
+    return false;
+}
+
+static void skipSpaces(JsonReader *reader) {
+    const char *p = reader->cursor;
+    while (p < reader->end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+    reader->cursor = p;
+}
+
+// Consume `c` (tras los espacios) si es el siguiente carácter
+static bool accept(JsonReader *reader, char c) {
+    skipSpaces(reader);
+    if (reader->cursor < reader->end && *reader->cursor == c) {
+        reader->cursor++;
+        return true;
+    }
+    return false;
+}
+
+// Consume la palabra `word` de longitud `length` si es lo que sigue
+static bool acceptWord(JsonReader *reader, const char *word, size_t length) {
+    if ((size_t)(reader->end - reader->cursor) < length) return false;
+    for (size_t k = 0; k < length; k++) {
+        if (reader->cursor[k] != word[k]) return false;
+    }
+    reader->cursor += length;
+    return true;
+}
+
+static bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Lee una cadena entre comillas; `value` apunta al contenido, sin decodificar los escapes
+static bool readString(JsonReader *reader, const char **value, size_t *length) {
+    if (!accept(reader, '"')) return fail(reader);
+    const char *start = reader->cursor;
+    const char *p = start;
+    while (p < reader->end && *p != '"') {
+        p += (*p == '\\') ? 2 : 1;
+    }
+    if (p >= reader->end) return fail(reader);
+    *value = start;
+    *length = (size_t)(p - start);
+    reader->cursor = p + 1;
+    return true;
+}
+
+// Avanza al siguiente elemento de un contenedor: `false` si lo cierra `close`
+static bool nextInContainer(JsonReader *reader, char close) {
+    if (reader->failed) return false;
+    if (accept(reader, close)) {
+        reader->first = false;  // El contenedor que lo incluye ya tiene este valor
+        return false;
+    }
+    if (!reader->first && !accept(reader, ',')) return fail(reader);
+    reader->first = false;
+    return true;
+}
+
+/* Function: JsonReader_init
+   Descripción:
+     Prepara el lector para recorrer `length` bytes de `text`. El texto no se copia ni se modifica y no
+     necesita terminar en '\0'.
+
+   Params:
+     reader - Lector a inicializar.
+     text - Texto JSON.
+     length - Bytes de `text`.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JsonReader_init(JsonReader *reader, const char *text, size_t length) {
+    reader->cursor = text;
+    reader->end = text + length;
+    reader->first = false;
+    reader->failed = text == NULL;
+}
+
+/* Function: JsonReader_beginObject
+   Descripción:
+     Consume el '{' con el que empieza un objeto; después se recorre con `JsonReader_nextKey`.
+
+   Params:
+     reader - Lector.
+
+   Returns:
+     - bool: `false` si el valor siguiente no es un objeto.
+*/
+bool JsonReader_beginObject(JsonReader *reader) {
+    if (reader->failed) return false;
+    if (!accept(reader, '{')) return fail(reader);
+    reader->first = true;
+    return true;
+}
+
+/* Function: JsonReader_nextKey
+   Descripción:
+     Lee la siguiente clave del objeto actual y el ':' que la sigue; luego hay que leer o saltar su valor.
+
+   Params:
+     reader - Lector.
+     key - Recibe un puntero a la clave dentro del texto (sin comillas).
+     length - Recibe la longitud de la clave.
+
+   Returns:
+     - bool: `true` si hay otra clave; `false` al cerrar el objeto o ante un error (ver `failed`).
+
+   Example:
+     while (JsonReader_nextKey(&reader, &key, &length)) {
+         if (JsonReader_equals(key, length, "score")) JsonReader_number(&reader, &score);
+         else JsonReader_skip(&reader);
+     }
+*/
+bool JsonReader_nextKey(JsonReader *reader, const char **key, size_t *length) {
+    if (!nextInContainer(reader, '}')) return false;
+    if (!readString(reader, key, length)) return false;
+    if (!accept(reader, ':')) return fail(reader);
+    return true;
+}
+
+/* Function: JsonReader_beginArray
+   Descripción:
+     Consume el '[' con el que empieza un arreglo; después se recorre con `JsonReader_nextElement`.
+
+   Params:
+     reader - Lector.
+
+   Returns:
+     - bool: `false` si el valor siguiente no es un arreglo.
+*/
+bool JsonReader_beginArray(JsonReader *reader) {
+    if (reader->failed) return false;
+    if (!accept(reader, '[')) return fail(reader);
+    reader->first = true;
+    return true;
+}
+
+/* Function: JsonReader_nextElement
+   Descripción:
+     Avanza al siguiente elemento del arreglo actual; luego hay que leer o saltar su valor.
+
+   Params:
+     reader - Lector.
+
+   Returns:
+     - bool: `true` si hay otro elemento; `false` al cerrar el arreglo o ante un error (ver `failed`).
+*/
+bool JsonReader_nextElement(JsonReader *reader) {
+    return nextInContainer(reader, ']');
+}
+
+/* Function: JsonReader_number
+   Descripción:
+     Lee un número sin pasar por `strtod` (no depende del locale ni necesita el '\0' final). `null`, que
+     es lo que escribe `JsonWriter_number` para NaN e infinito, se lee como 0.
+
+   Params:
+     reader - Lector.
+     value - Recibe el número.
+
+   Returns:
+     - bool: `false` si el valor siguiente no es un número.
+
+   Problems:
+     - Problema: Con más de 18 dígitos significativos la mantisa no cabe en un entero.
+       - Solución: Los dígitos sobrantes sólo ajustan el exponente; la precisión de un double es menor.
+*/
+bool JsonReader_number(JsonReader *reader, double *value) {
+    if (reader->failed) return false;
+    skipSpaces(reader);
+    if (acceptWord(reader, "null", 4)) {
+        *value = 0;
+        return true;
+    }
+
+    const char *p = reader->cursor;
+    const char *end = reader->end;
+    bool negative = p < end && *p == '-';
+    if (negative) p++;
+    if (p >= end || !isDigit(*p)) return fail(reader);
+
+    int64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    for (; p < end && isDigit(*p); p++) {
+        if (digits < JSON_READER_MANTISSA_DIGITS) {
+            mantissa = mantissa * 10 + (*p - '0');
+            if (mantissa != 0) digits++;
+        } else {
+            exponent++;
+        }
+    }
+    if (p < end && *p == '.') {
+        p++;
+        if (p >= end || !isDigit(*p)) return fail(reader);
+        for (; p < end && isDigit(*p); p++) {
+            if (digits < JSON_READER_MANTISSA_DIGITS) {
+                mantissa = mantissa * 10 + (*p - '0');
+                if (mantissa != 0) digits++;
+                exponent--;
+            }
+        }
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negativeExponent = p < end && *p == '-';
+        if (p < end && (*p == '-' || *p == '+')) p++;
+        if (p >= end || !isDigit(*p)) return fail(reader);
+        int written = 0;
+        for (; p < end && isDigit(*p); p++) {
+            if (written < 10 * JSON_READER_MAX_EXPONENT) written = written * 10 + (*p - '0');
+        }
+        exponent += negativeExponent ? -written : written;
+    }
+
+    // Con mantisa < 2^53 y |exponente| <= 22 una sola operación con una potencia exacta redondea bien
+    double result = (double)mantissa;
+    if (exponent > JSON_READER_MAX_EXPONENT) exponent = JSON_READER_MAX_EXPONENT;
+    if (exponent < -JSON_READER_MAX_EXPONENT) exponent = -JSON_READER_MAX_EXPONENT;
+    for (; exponent > JSON_READER_EXACT_POWERS; exponent -= JSON_READER_EXACT_POWERS) result *= powersOfTen[JSON_READER_EXACT_POWERS];
+    for (; exponent < -JSON_READER_EXACT_POWERS; exponent += JSON_READER_EXACT_POWERS) result /= powersOfTen[JSON_READER_EXACT_POWERS];
+    result = exponent >= 0 ? result * powersOfTen[exponent] : result / powersOfTen[-exponent];
+
+    *value = negative ? -result : result;
+    reader->cursor = p;
+    return true;
+}
+
+/* Function: JsonReader_bool
+   Descripción:
+     Lee `true` o `false`. También acepta un número (distinto de 0 es `true`), como los booleanos que
+     llegan de los programas que los serializan como enteros.
+
+   Params:
+     reader - Lector.
+     value - Recibe el booleano.
+
+   Returns:
+     - bool: `false` si el valor siguiente no es un booleano ni un número.
+*/
+bool JsonReader_bool(JsonReader *reader, bool *value) {
+    if (reader->failed) return false;
+    skipSpaces(reader);
+    if (acceptWord(reader, "true", 4)) {
+        *value = true;
+        return true;
+    }
+    if (acceptWord(reader, "false", 5)) {
+        *value = false;
+        return true;
+    }
+    double number;
+    if (!JsonReader_number(reader, &number)) return false;
+    *value = number != 0;
+    return true;
+}
+
+/* Function: JsonReader_string
+   Descripción:
+     Lee una cadena. El resultado apunta al texto original, entre las comillas, con los escapes sin decodificar.
+
+   Params:
+     reader - Lector.
+     value - Recibe un puntero al contenido de la cadena.
+     length - Recibe su longitud en bytes.
+
+   Returns:
+     - bool: `false` si el valor siguiente no es una cadena.
+*/
+bool JsonReader_string(JsonReader *reader, const char **value, size_t *length) {
+    if (reader->failed) return false;
+    return readString(reader, value, length);
+}
+
+static bool skipValue(JsonReader *reader, int depth) {
+    if (depth > JSON_READER_MAX_DEPTH) return fail(reader);
+    skipSpaces(reader);
+    if (reader->cursor >= reader->end) return fail(reader);
+
+    const char *key;
+    size_t length;
+    switch (*reader->cursor) {
+        case '{':
+            JsonReader_beginObject(reader);
+            while (JsonReader_nextKey(reader, &key, &length)) {
+                if (!skipValue(reader, depth + 1)) return false;
+            }
+            return !reader->failed;
+        case '[':
+            JsonReader_beginArray(reader);
+            while (JsonReader_nextElement(reader)) {
+                if (!skipValue(reader, depth + 1)) return false;
+            }
+            return !reader->failed;
+        case '"':
+            return readString(reader, &key, &length);
+        case 't':
+        case 'f': {
+            bool ignored;
+            return JsonReader_bool(reader, &ignored);
+        }
+        default: {
+            double ignored;
+            return JsonReader_number(reader, &ignored);
+        }
+    }
+}
+
+/* Function: JsonReader_skip
+   Descripción:
+     Salta el valor siguiente, de cualquier tipo, incluidos los objetos y arreglos anidados.
+
+   Params:
+     reader - Lector.
+
+   Returns:
+     - bool: `false` ante un error de sintaxis o un anidamiento mayor que `JSON_READER_MAX_DEPTH`.
+*/
+bool JsonReader_skip(JsonReader *reader) {
+    if (reader->failed) return false;
+    return skipValue(reader, 0);
+}
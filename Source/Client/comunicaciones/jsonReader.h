@@ -0,0 +1,59 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef JSON_READER_H
+#define JSON_READER_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*
+ * Header: JSON Reader
+ * Lector de JSON en flujo (pull): quien lo usa pide los elementos en el orden en que aparecen en el texto
+ * y los escribe directamente donde corresponden, sin construir un árbol ni reservar memoria. Es la
+ * contraparte de `JsonWriter`.
+ *
+ *   - `JsonReader_nextKey` y `JsonReader_nextElement` recorren un objeto o un arreglo y manejan las comas;
+ *     devuelven `false` al cerrar el contenedor.
+ *   - Cada valor se lee con la función de su tipo o se salta con `JsonReader_skip`.
+ *   - El primer error de sintaxis activa `failed` y desde ahí todas las funciones devuelven `false`, así
+ *     que basta revisar `failed` al final.
+ *
+ * Las claves y cadenas se devuelven como punteros al texto original, sin decodificar los escapes.
+ */
+
+#define JSON_READER_MAX_DEPTH 64  // Anidamiento máximo que acepta `JsonReader_skip`
+
+typedef struct {
+    const char *cursor;  // Siguiente carácter por leer
+    const char *end;     // Fin del texto
+    bool first;          // El contenedor actual todavía no tuvo elementos (no espera coma)
+    bool failed;         // Se activó con el primer error de sintaxis
+} JsonReader;
+
+// Constructor
+void JsonReader_init(JsonReader *reader, const char *text, size_t length);
+
+// Métodos de la clase
+bool JsonReader_beginObject(JsonReader *reader);
+bool JsonReader_nextKey(JsonReader *reader, const char **key, size_t *length);
+bool JsonReader_beginArray(JsonReader *reader);
+bool JsonReader_nextElement(JsonReader *reader);
+bool JsonReader_number(JsonReader *reader, double *value);
+bool JsonReader_bool(JsonReader *reader, bool *value);
+bool JsonReader_string(JsonReader *reader, const char **value, size_t *length);
+bool JsonReader_skip(JsonReader *reader);
+
+// Compara una clave (o cadena) leída con un literal de C
+#define JsonReader_equals(text, length, literal) \
+    ((length) == sizeof(literal) - 1 && memcmp((text), (literal), sizeof(literal) - 1) == 0)
+
+#endif // JSON_READER_H
@@ -0,0 +1,329 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "jsonWriter.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#define JSON_WRITER_INITIAL_CAPACITY 4096
+#define JSON_WRITER_DECIMALS 3
+#define JSON_WRITER_DECIMAL_SCALE 1000.0
+#define JSON_WRITER_MAX_INTEGER 9.0e18      // Menor que 2^63: cabe en un long long
+
+static pthread_key_t writerKey;
+static pthread_once_t writerKeyOnce = PTHREAD_ONCE_INIT;
+
+static void destroyThreadWriter(void *value) {
+    JsonWriter *writer = value;
+    JsonWriter_free(writer);
+    free(writer);
+}
+
+static void createWriterKey() {
+    pthread_key_create(&writerKey, destroyThreadWriter);
+}
+
+/* Function: JsonWriter_threadInstance
+   Descripción:
+     Devuelve el escritor propio del hilo que llama. Se crea la primera vez y se libera
+     automáticamente cuando el hilo termina.
+
+   Params:
+     (Ninguno)
+
+   Returns:
+     - JsonWriter*: Escritor del hilo actual, o `NULL` si no hay memoria.
+
+   Restriction:
+     - El escritor no debe compartirse con otros hilos.
+
+   Example:
+     JsonWriter *writer = JsonWriter_threadInstance();
+     JsonWriter_reset(writer);
+
+   Problems:
+     - Problema: Un buffer global obligaría a sincronizar a todos los hilos que generan mensajes.
+       - Solución: Cada hilo tiene su propio buffer mediante `pthread_getspecific`.
+
+   References:
+     - pthread_key_create: https://man7.org/linux/man-pages/man3/pthread_key_create.3p.html
+*/
+JsonWriter *JsonWriter_threadInstance() {
+    pthread_once(&writerKeyOnce, createWriterKey);
+
+    JsonWriter *writer = pthread_getspecific(writerKey);
+    if (writer == NULL) {
+        writer = malloc(sizeof(JsonWriter));
+        if (writer == NULL) {
+            return NULL;
+        }
+        JsonWriter_init(writer, JSON_WRITER_INITIAL_CAPACITY);
+        pthread_setspecific(writerKey, writer);
+    }
+    return writer;
+}
+
+/* Function: JsonWriter_init
+   Descripción:
+     Inicializa un escritor con un buffer de `initialCapacity` bytes.
+
+   Params:
+     writer - Escritor a inicializar.
+     initialCapacity - Capacidad inicial del buffer.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JsonWriter_init(JsonWriter *writer, size_t initialCapacity) {
+    if (initialCapacity < 16) initialCapacity = 16;
+    writer->data = malloc(initialCapacity);
+    writer->capacity = writer->data != NULL ? initialCapacity : 0;
+    writer->failed = writer->data == NULL;
+    writer->length = 0;
+    if (writer->data != NULL) writer->data[0] = '\0';
+}
+
+/* Function: JsonWriter_free
+   Descripción:
+     Libera el buffer del escritor.
+
+   Params:
+     writer - Escritor cuyo buffer se libera.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JsonWriter_free(JsonWriter *writer) {
+    free(writer->data);
+    writer->data = NULL;
+    writer->length = 0;
+    writer->capacity = 0;
+}
+
+/* Function: JsonWriter_reset
+   Descripción:
+     Vacía el escritor para generar un mensaje nuevo, conservando la memoria ya reservada.
+
+   Params:
+     writer - Escritor a reiniciar.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JsonWriter_reset(JsonWriter *writer) {
+    writer->length = 0;
+    writer->failed = writer->data == NULL;
+    if (writer->data != NULL) writer->data[0] = '\0';
+}
+
+// Garantiza espacio para `extra` bytes más el '\0' final
+static bool reserve(JsonWriter *writer, size_t extra) {
+    if (writer->failed) return false;
+    size_t needed = writer->length + extra + 1;
+    if (needed <= writer->capacity) return true;
+
+    size_t capacity = writer->capacity * 2;
+    while (capacity < needed) capacity *= 2;
+
+    char *data = realloc(writer->data, capacity);
+    if (data == NULL) {
+        writer->failed = true;
+        return false;
+    }
+    writer->data = data;
+    writer->capacity = capacity;
+    return true;
+}
+
+/* Function: JsonWriter_raw
+   Descripción:
+     Agrega texto sin modificarlo (llaves, comas, claves ya entrecomilladas, etc.).
+
+   Params:
+     writer - Escritor.
+     text - Texto a agregar.
+     length - Longitud del texto.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JsonWriter_raw(JsonWriter *writer, const char *text, size_t length) {
+    if (!reserve(writer, length)) return;
+    memcpy(writer->data + writer->length, text, length);
+    writer->length += length;
+    writer->data[writer->length] = '\0';
+}
+
+/* Function: JsonWriter_key
+   Descripción:
+     Agrega una clave entre comillas seguida de ':'.
+
+   Params:
+     writer - Escritor.
+     key - Clave sin comillas; no se escapa.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JsonWriter_key(JsonWriter *writer, const char *key) {
+    size_t length = strlen(key);
+    if (!reserve(writer, length + 3)) return;
+    char *out = writer->data + writer->length;
+    *out++ = '"';
+    memcpy(out, key, length);
+    out += length;
+    *out++ = '"';
+    *out++ = ':';
+    writer->length += length + 3;
+    writer->data[writer->length] = '\0';
+}
+
+/* Function: JsonWriter_int
+   Descripción:
+     Agrega un entero en base 10 sin usar `printf`.
+
+   Params:
+     writer - Escritor.
+     value - Valor a escribir.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JsonWriter_int(JsonWriter *writer, long long value) {
+    char digits[24];
+    int n = 0;
+    unsigned long long magnitude = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+
+    do {
+        digits[n++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    if (!reserve(writer, (size_t)n + 1)) return;
+    char *out = writer->data + writer->length;
+    if (value < 0) *out++ = '-';
+    while (n > 0) *out++ = digits[--n];
+
+    writer->length = (size_t)(out - writer->data);
+    writer->data[writer->length] = '\0';
+}
+
+/* Function: JsonWriter_number
+   Descripción:
+     Agrega un número real. Los valores enteros se escriben sin decimales (igual que cJSON) y el resto
+     con hasta tres decimales, suficiente para posiciones en pantalla.
+
+   Params:
+     writer - Escritor.
+     value - Valor a escribir.
+
+   Returns:
+     - void: No retorna valores.
+
+   Problems:
+     - Problema: JSON no admite NaN ni infinito.
+       - Solución: Se escribe `null`, igual que cJSON.
+     - Problema: Convertir a `long long` un valor de magnitud 2^63 o mayor es comportamiento indefinido.
+       - Solución: Esos valores se escriben con `snprintf("%.17g")`, que los representa sin pérdida.
+*/
+void JsonWriter_number(JsonWriter *writer, double value) {
+    if (isnan(value) || isinf(value)) {
+        JsonWriter_literal(writer, "null");
+        return;
+    }
+
+    if (fabs(value) >= JSON_WRITER_MAX_INTEGER) {
+        char text[32];
+        int n = snprintf(text, sizeof(text), "%.17g", value);
+        JsonWriter_raw(writer, text, (size_t)n);
+        return;
+    }
+
+    double scaled = round(fabs(value) * JSON_WRITER_DECIMAL_SCALE);
+    if (scaled >= 9.0e15) {
+        JsonWriter_int(writer, (long long)value);  // Fuera del rango útil para decimales
+        return;
+    }
+
+    long long total = (long long)scaled;
+    long long integer = total / (long long)JSON_WRITER_DECIMAL_SCALE;
+    int fraction = (int)(total % (long long)JSON_WRITER_DECIMAL_SCALE);
+
+    if (value < 0 && total != 0) JsonWriter_literal(writer, "-");
+    JsonWriter_int(writer, integer);
+    if (fraction == 0) return;
+
+    char decimals[JSON_WRITER_DECIMALS + 1];
+    int n = JSON_WRITER_DECIMALS;
+    for (int i = JSON_WRITER_DECIMALS - 1; i >= 0; i--) {
+        decimals[i] = (char)('0' + fraction % 10);
+        fraction /= 10;
+    }
+    while (decimals[n - 1] == '0') n--;  // Quitar ceros a la derecha
+
+    decimals[n] = '\0';
+    JsonWriter_literal(writer, ".");
+    JsonWriter_raw(writer, decimals, (size_t)n);
+}
+
+/* Function: JsonWriter_bool
+   Descripción:
+     Agrega `true` o `false`.
+
+   Params:
+     writer - Escritor.
+     value - Valor a escribir.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JsonWriter_bool(JsonWriter *writer, bool value) {
+    if (value) {
+        JsonWriter_literal(writer, "true");
+    } else {
+        JsonWriter_literal(writer, "false");
+    }
+}
+
+/* Function: JsonWriter_string
+   Descripción:
+     Agrega una cadena entre comillas, escapando comillas, barras invertidas y caracteres de control.
+
+   Params:
+     writer - Escritor.
+     value - Cadena a escribir.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JsonWriter_string(JsonWriter *writer, const char *value) {
+    static const char hex[] = "0123456789abcdef";
+
+    JsonWriter_literal(writer, "\"");
+    for (const unsigned char *c = (const unsigned char *)value; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            char escaped[2] = { '\\', (char)*c };
+            JsonWriter_raw(writer, escaped, 2);
+        } else if (*c < 0x20) {
+            char escaped[6] = { '\\', 'u', '0', '0', hex[*c >> 4], hex[*c & 0xF] };
+            JsonWriter_raw(writer, escaped, 6);
+        } else {
+            JsonWriter_raw(writer, (const char *)c, 1);
+        }
+    }
+    JsonWriter_literal(writer, "\"");
+}
@@ -0,0 +1,51 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Header: JSON Writer
+ * Escritor de JSON en flujo. Agrega texto directamente a un buffer que crece según se necesite y
+ * se reutiliza entre mensajes, de modo que generar un mensaje no crea nodos ni reserva memoria
+ * una vez que el buffer alcanzó su tamaño de trabajo.
+ *
+ * El escritor no valida la estructura: quien lo usa es responsable de abrir y cerrar objetos,
+ * arreglos y comas en el orden correcto. Las claves se escriben tal cual, sin escapar.
+ */
+
+typedef struct {
+    char *data;       // Texto generado, siempre terminado en '\0'
+    size_t length;    // Bytes escritos sin contar el '\0'
+    size_t capacity;  // Bytes reservados en `data`
+    bool failed;      // Se activó si no hubo memoria para crecer
+} JsonWriter;
+
+// Constructor y Destructor
+JsonWriter *JsonWriter_threadInstance();
+void JsonWriter_init(JsonWriter *writer, size_t initialCapacity);
+void JsonWriter_free(JsonWriter *writer);
+
+// Métodos de la clase
+void JsonWriter_reset(JsonWriter *writer);
+void JsonWriter_raw(JsonWriter *writer, const char *text, size_t length);
+void JsonWriter_key(JsonWriter *writer, const char *key);
+void JsonWriter_int(JsonWriter *writer, long long value);
+void JsonWriter_number(JsonWriter *writer, double value);
+void JsonWriter_bool(JsonWriter *writer, bool value);
+void JsonWriter_string(JsonWriter *writer, const char *value);
+
+// Agrega un literal de C sin calcular su longitud en tiempo de ejecución
+#define JsonWriter_literal(writer, text) JsonWriter_raw((writer), (text), sizeof(text) - 1)
+
+#endif // JSON_WRITER_H
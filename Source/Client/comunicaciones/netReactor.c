@@ -0,0 +1,534 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "netReactor.h"
+#include "../logs/saveLog.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <log.h>
+
+#define NET_REACTOR_MAX_EVENTS 8
+#define NET_REACTOR_MAX_IOV 64
+
+// ============================================================================================================= //
+// COLA MPSC (Vyukov)
+
+static void queue_push(NetReactor *reactor, OutboundMessage *message) {
+    atomic_store_explicit(&message->next, NULL, memory_order_relaxed);
+    OutboundMessage *previous = atomic_exchange_explicit(&reactor->head, message, memory_order_acq_rel);
+    atomic_store_explicit(&previous->next, message, memory_order_release);
+}
+
+// Sólo el hilo del reactor. Retorna NULL si la cola está vacía o un productor está a medio encolar.
+static OutboundMessage *queue_pop(NetReactor *reactor) {
+    OutboundMessage *tail = reactor->tail;
+    OutboundMessage *next = atomic_load_explicit(&tail->next, memory_order_acquire);
+
+    if (tail == reactor->stub) {
+        if (next == NULL) return NULL;
+        reactor->tail = next;
+        tail = next;
+        next = atomic_load_explicit(&next->next, memory_order_acquire);
+    }
+    if (next != NULL) {
+        reactor->tail = next;
+        return tail;
+    }
+    if (tail != atomic_load_explicit(&reactor->head, memory_order_acquire)) {
+        return NULL;
+    }
+    queue_push(reactor, reactor->stub);
+    next = atomic_load_explicit(&tail->next, memory_order_acquire);
+    if (next != NULL) {
+        reactor->tail = next;
+        return tail;
+    }
+    return NULL;
+}
+
+// ============================================================================================================= //
+// UTILIDADES
+
+static long long now_ms() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static long long timespec_ms(const struct timespec *ts) {
+    return (long long)ts->tv_sec * 1000 + ts->tv_nsec / 1000000;
+}
+
+static void schedule_reconnect(NetReactor *reactor) {
+    long long at = now_ms() + reactor->backoffMs;
+    reactor->nextAttempt.tv_sec = at / 1000;
+    reactor->nextAttempt.tv_nsec = (at % 1000) * 1000000;
+
+    savelog_error("Error al conectar al servidor, reintentando en %d ms...\n", reactor->backoffMs);
+    reactor->backoffMs *= 2;
+    if (reactor->backoffMs > NET_REACTOR_BACKOFF_MAX_MS) {
+        reactor->backoffMs = NET_REACTOR_BACKOFF_MAX_MS;
+    }
+}
+
+static void watch_socket(NetReactor *reactor, int op, uint32_t events) {
+    struct epoll_event event = { 0 };
+    event.events = events;
+    event.data.fd = reactor->socket->sock;
+    epoll_ctl(reactor->epollFd, op, reactor->socket->sock, &event);
+}
+
+static void release_message(NetReactor *reactor, OutboundMessage *message) {
+    atomic_fetch_sub_explicit(&reactor->queuedBytes, message->length, memory_order_relaxed);
+    free(message);
+}
+
+static void disconnect(NetReactor *reactor) {
+    if (reactor->socket->sock >= 0) {
+        epoll_ctl(reactor->epollFd, EPOLL_CTL_DEL, reactor->socket->sock, NULL);
+    }
+    SocketServer_close(reactor->socket);
+    reactor->state = NET_DISCONNECTED;
+    reactor->wantWrite = false;
+
+    // Un mensaje enviado a medias no se puede completar en la nueva conexión
+    if (reactor->outFirst != NULL && reactor->outOffset > 0) {
+        OutboundMessage *partial = reactor->outFirst;
+        reactor->outFirst = partial->outNext;
+        if (reactor->outFirst == NULL) reactor->outLast = NULL;
+        release_message(reactor, partial);
+    }
+    reactor->outOffset = 0;
+    FrameReader_reset(reactor->reader);
+
+    schedule_reconnect(reactor);
+}
+
+static void on_connected(NetReactor *reactor) {
+    reactor->state = NET_CONNECTED;
+    reactor->backoffMs = NET_REACTOR_BACKOFF_MIN_MS;
+    reactor->wantWrite = false;
+    watch_socket(reactor, EPOLL_CTL_MOD, EPOLLIN | EPOLLRDHUP);
+}
+
+static void try_connect(NetReactor *reactor) {
+    int result = SocketServer_connect(reactor->socket);
+    if (result < 0) {
+        reactor->state = NET_DISCONNECTED;
+        schedule_reconnect(reactor);
+        return;
+    }
+
+    reactor->state = NET_CONNECTING;
+    watch_socket(reactor, EPOLL_CTL_ADD, EPOLLOUT);
+    if (result == 0) {
+        on_connected(reactor);
+    }
+}
+
+// ============================================================================================================= //
+// ENTRADA / SALIDA
+
+static void read_socket(NetReactor *reactor) {
+    struct iovec regions[2];
+    char *frame;
+    size_t length;
+
+    while (reactor->state == NET_CONNECTED) {
+        int count = FrameReader_writeRegions(reactor->reader, regions);
+        if (count == 0) {
+            FrameReader_reset(reactor->reader);  // Sin memoria para crecer: se pierde lo acumulado
+            continue;
+        }
+
+        ssize_t bytesReceived = SocketServer_receivev(reactor->socket, regions, count);
+        if (bytesReceived > 0) {
+            FrameReader_commit(reactor->reader, (size_t)bytesReceived);
+            while (FrameReader_next(reactor->reader, &frame, &length)) {
+                if (reactor->onData != NULL) {
+                    reactor->onData(reactor->context, frame, length);
+                }
+            }
+        } else if (bytesReceived < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;  // No hay más datos por ahora
+        } else {
+            log_warn("Conexión con el servidor perdida\n");
+            disconnect(reactor);
+            return;
+        }
+    }
+}
+
+static void collect_outbound(NetReactor *reactor) {
+    OutboundMessage *message;
+    while ((message = queue_pop(reactor)) != NULL) {
+        message->outNext = NULL;
+        if (reactor->outLast != NULL) {
+            reactor->outLast->outNext = message;
+        } else {
+            reactor->outFirst = message;
+        }
+        reactor->outLast = message;
+    }
+}
+
+static void flush_outbound(NetReactor *reactor) {
+    while (reactor->state == NET_CONNECTED && reactor->outFirst != NULL) {
+        struct iovec parts[NET_REACTOR_MAX_IOV];
+        int count = 0;
+
+        for (OutboundMessage *m = reactor->outFirst; m != NULL && count < NET_REACTOR_MAX_IOV; m = m->outNext) {
+            size_t skip = (m == reactor->outFirst) ? reactor->outOffset : 0;
+            parts[count].iov_base = m->data + skip;
+            parts[count].iov_len = m->length - skip;
+            count++;
+        }
+
+        ssize_t sent = SocketServer_sendv(reactor->socket, parts, count);
+        if (sent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;  // Esperar EPOLLOUT
+            }
+            log_error("Error al enviar el mensaje\n");
+            disconnect(reactor);
+            return;
+        }
+
+        // Liberar los mensajes completos y recordar cuánto se envió del siguiente
+        size_t remaining = (size_t)sent;
+        while (reactor->outFirst != NULL) {
+            OutboundMessage *first = reactor->outFirst;
+            size_t pending = first->length - reactor->outOffset;
+            if (remaining < pending) {
+                reactor->outOffset += remaining;
+                break;
+            }
+            remaining -= pending;
+            reactor->outOffset = 0;
+            reactor->outFirst = first->outNext;
+            if (reactor->outFirst == NULL) reactor->outLast = NULL;
+            release_message(reactor, first);
+        }
+    }
+
+    if (reactor->state != NET_CONNECTED) return;
+
+    // Sólo pedir EPOLLOUT mientras quede algo por enviar
+    bool wantWrite = reactor->outFirst != NULL;
+    if (wantWrite != reactor->wantWrite) {
+        watch_socket(reactor, EPOLL_CTL_MOD, EPOLLIN | EPOLLRDHUP | (wantWrite ? EPOLLOUT : 0));
+        reactor->wantWrite = wantWrite;
+    }
+}
+
+static void handle_socket_event(NetReactor *reactor, uint32_t events) {
+    if (reactor->state == NET_CONNECTING) {
+        if (SocketServer_finishConnect(reactor->socket) == 0) {
+            on_connected(reactor);
+        } else {
+            disconnect(reactor);
+        }
+        return;
+    }
+
+    if (events & EPOLLIN) {
+        read_socket(reactor);
+    }
+    if (reactor->state == NET_CONNECTED && (events & (EPOLLERR | EPOLLHUP))) {
+        log_warn("El servidor se ha desconectado\n");
+        disconnect(reactor);
+    }
+}
+
+/* Function: NetReactor_loop
+   Descripción:
+     Bucle del hilo del reactor: conecta y reconecta, espera eventos del socket y del eventfd con
+     `epoll_wait`, entrega los datos recibidos y envía los mensajes encolados.
+
+   Params:
+     arg - Puntero al `NetReactor`.
+
+   Returns:
+     - void*: `NULL` al detenerse el reactor.
+
+   Problems:
+     - Problema: Si el servidor no está disponible, el hilo no debe consumir CPU.
+       - Solución: Mientras no hay conexión, `epoll_wait` espera hasta el próximo intento de reconexión.
+
+   References:
+     - epoll: https://man7.org/linux/man-pages/man7/epoll.7.html
+     - eventfd: https://man7.org/linux/man-pages/man2/eventfd.2.html
+*/
+static void *NetReactor_loop(void *arg) {
+    NetReactor *reactor = (NetReactor *)arg;
+    struct epoll_event events[NET_REACTOR_MAX_EVENTS];
+
+    while (atomic_load(&reactor->running)) {
+        int timeout = -1;
+        if (reactor->state == NET_DISCONNECTED) {
+            long long wait = timespec_ms(&reactor->nextAttempt) - now_ms();
+            if (wait <= 0) {
+                try_connect(reactor);
+                if (reactor->state == NET_CONNECTED) {
+                    collect_outbound(reactor);
+                    flush_outbound(reactor);
+                }
+                continue;
+            }
+            timeout = wait > INT_MAX ? INT_MAX : (int)wait;
+        }
+
+        int ready = epoll_wait(reactor->epollFd, events, NET_REACTOR_MAX_EVENTS, timeout);
+        if (ready < 0 && errno != EINTR) {
+            log_error("Error en epoll_wait\n");
+            break;
+        }
+
+        for (int i = 0; i < ready; i++) {
+            if (events[i].data.fd == reactor->wakeFd) {
+                uint64_t value;
+                ssize_t ignored = read(reactor->wakeFd, &value, sizeof(value));
+                (void)ignored;
+            } else if (events[i].data.fd == reactor->socket->sock) {
+                handle_socket_event(reactor, events[i].events);
+            }
+        }
+
+        collect_outbound(reactor);
+        flush_outbound(reactor);
+    }
+
+    return NULL;
+}
+
+// ============================================================================================================= //
+// API
+
+/* Function: NetReactor_create
+   Descripción:
+     Crea el reactor de red para el socket indicado. No inicia el hilo; ver `NetReactor_start`.
+
+   Params:
+     socket - Servidor de sockets cuyo descriptor pasará a manejar el reactor.
+     mode - Delimitación de los mensajes en ambos sentidos (`FRAME_MODE_NEWLINE` para el servidor JSON).
+     onData - Callback que recibe cada mensaje completo; se ejecuta en el hilo del reactor. En modo
+              `FRAME_MODE_NEWLINE` el mensaje viene terminado en '\0'.
+     context - Puntero que se pasa tal cual al callback.
+
+   Returns:
+     - NetReactor*: Reactor creado o `NULL` si falla la creación de epoll/eventfd o no hay memoria.
+
+   Example:
+     NetReactor *reactor = NetReactor_create(socketServer, FRAME_MODE_NEWLINE, ComServer_onData, comServer);
+     NetReactor_start(reactor);
+
+   Problems:
+     - Problema: Si falla alguna de las llamadas al sistema, el reactor no puede funcionar.
+       - Solución: Se liberan los recursos ya creados y se retorna `NULL`.
+
+   References:
+     - epoll_create1: https://man7.org/linux/man-pages/man2/epoll_create1.2.html
+*/
+NetReactor *NetReactor_create(SocketServer *socket, FrameMode mode, NetReactorDataCallback onData, void *context) {
+    NetReactor *reactor = calloc(1, sizeof(NetReactor));
+    if (reactor == NULL) {
+        savelog_error("Error al asignar memoria para NetReactor\n");
+        return NULL;
+    }
+
+    reactor->socket = socket;
+    reactor->onData = onData;
+    reactor->context = context;
+    reactor->mode = mode;
+    reactor->reader = FrameReader_create(mode, 0);
+    reactor->state = NET_DISCONNECTED;
+    reactor->backoffMs = NET_REACTOR_BACKOFF_MIN_MS;
+    reactor->epollFd = epoll_create1(EPOLL_CLOEXEC);
+    reactor->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    reactor->stub = calloc(1, sizeof(OutboundMessage));
+    atomic_init(&reactor->running, false);
+    atomic_init(&reactor->queuedBytes, 0);
+
+    if (reactor->epollFd < 0 || reactor->wakeFd < 0 || reactor->stub == NULL || reactor->reader == NULL) {
+        savelog_error("Error al crear el reactor de red\n");
+        NetReactor_destroy(reactor);
+        return NULL;
+    }
+
+    atomic_init(&reactor->stub->next, NULL);
+    atomic_init(&reactor->head, reactor->stub);
+    reactor->tail = reactor->stub;
+
+    struct epoll_event event = { 0 };
+    event.events = EPOLLIN;
+    event.data.fd = reactor->wakeFd;
+    epoll_ctl(reactor->epollFd, EPOLL_CTL_ADD, reactor->wakeFd, &event);
+
+    return reactor;
+}
+
+/* Function: NetReactor_start
+   Descripción:
+     Inicia el hilo del reactor. Llamarla de nuevo con el reactor ya iniciado no tiene efecto.
+
+   Params:
+     reactor - Reactor a iniciar.
+
+   Returns:
+     - bool: `true` si el hilo está corriendo.
+
+   References:
+     - pthread_create: https://man7.org/linux/man-pages/man3/pthread_create.3.html
+*/
+bool NetReactor_start(NetReactor *reactor) {
+    if (reactor == NULL) return false;
+    if (reactor->started) return true;
+
+    atomic_store(&reactor->running, true);
+    if (pthread_create(&reactor->thread, NULL, NetReactor_loop, reactor) != 0) {
+        atomic_store(&reactor->running, false);
+        savelog_error("Error al crear el hilo del reactor de red\n");
+        return false;
+    }
+    reactor->started = true;
+    return true;
+}
+
+/* Function: NetReactor_stop
+   Descripción:
+     Detiene el hilo del reactor y espera a que termine.
+
+   Params:
+     reactor - Reactor a detener.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void NetReactor_stop(NetReactor *reactor) {
+    if (reactor == NULL || !reactor->started) return;
+
+    atomic_store(&reactor->running, false);
+    uint64_t one = 1;
+    ssize_t ignored = write(reactor->wakeFd, &one, sizeof(one));
+    (void)ignored;
+    pthread_join(reactor->thread, NULL);
+    reactor->started = false;
+}
+
+/* Function: NetReactor_destroy
+   Descripción:
+     Detiene el reactor, cierra el socket y libera los mensajes pendientes.
+
+   Params:
+     reactor - Reactor a liberar (puede ser `NULL`).
+
+   Returns:
+     - void: No retorna valores.
+*/
+void NetReactor_destroy(NetReactor *reactor) {
+    if (reactor == NULL) return;
+
+    NetReactor_stop(reactor);
+    if (reactor->socket != NULL) {
+        SocketServer_close(reactor->socket);
+    }
+
+    if (reactor->stub != NULL) {
+        collect_outbound(reactor);
+        while (reactor->outFirst != NULL) {
+            OutboundMessage *next = reactor->outFirst->outNext;
+            free(reactor->outFirst);
+            reactor->outFirst = next;
+        }
+        free(reactor->stub);
+    }
+
+    if (reactor->epollFd >= 0) close(reactor->epollFd);
+    if (reactor->wakeFd >= 0) close(reactor->wakeFd);
+    FrameReader_destroy(reactor->reader);
+    free(reactor);
+}
+
+/* Function: NetReactor_send
+   Descripción:
+     Encola un mensaje para enviarlo al servidor seguido del delimitador '\n' (o precedido por su longitud
+     en modo `FRAME_MODE_LENGTH_PREFIXED`). Puede llamarse desde cualquier hilo; no bloquea ni toca el socket.
+
+   Params:
+     reactor - Reactor que enviará el mensaje.
+     message - Mensaje a enviar (se copia).
+     length - Longitud del mensaje sin el delimitador.
+
+   Returns:
+     - bool: `true` si se encoló, `false` si no hay memoria o hay demasiados datos pendientes.
+
+   Restriction:
+     - En modo `FRAME_MODE_NEWLINE`, `message` no debe contener '\n'.
+
+   Example:
+     NetReactor_send(reactor, json, strlen(json));
+
+   Problems:
+     - Problema: Sin conexión, los estados del juego se acumularían sin límite.
+       - Solución: Se descartan mensajes nuevos mientras haya más de `NET_REACTOR_MAX_QUEUED_BYTES` pendientes.
+     - Problema: El mensaje vive en un buffer del hilo que llama (por ejemplo el `JsonWriter` del hilo de
+       envío), que lo reutiliza en cuanto esta función retorna, y el socket lo escribe después el hilo del reactor.
+       - Solución: Se copia una vez en el nodo de la cola, junto con el delimitador. Es la única copia: el
+         reactor envía los nodos pendientes directamente desde ahí con un solo `SocketServer_sendv`.
+
+   References:
+     - Vyukov, D. Intrusive MPSC node-based queue.
+       https://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+*/
+bool NetReactor_send(NetReactor *reactor, const char *message, size_t length) {
+    if (reactor == NULL) return false;
+
+    bool prefixed = reactor->mode == FRAME_MODE_LENGTH_PREFIXED;
+    size_t total = length + (prefixed ? FRAME_READER_LENGTH_HEADER : 1);
+    if (atomic_load_explicit(&reactor->queuedBytes, memory_order_relaxed) + total > NET_REACTOR_MAX_QUEUED_BYTES) {
+        log_warn("Cola de salida llena, se descarta el mensaje\n");
+        return false;
+    }
+
+    OutboundMessage *node = malloc(sizeof(OutboundMessage) + total);
+    if (node == NULL) {
+        savelog_error("Error al asignar memoria para el mensaje de salida\n");
+        return false;
+    }
+    node->outNext = NULL;
+    node->length = total;
+    if (prefixed) {
+        node->data[0] = (char)(length >> 24);
+        node->data[1] = (char)(length >> 16);
+        node->data[2] = (char)(length >> 8);
+        node->data[3] = (char)length;
+        memcpy(node->data + FRAME_READER_LENGTH_HEADER, message, length);
+    } else {
+        memcpy(node->data, message, length);
+        node->data[length] = '\n';
+    }
+
+    atomic_fetch_add_explicit(&reactor->queuedBytes, total, memory_order_relaxed);
+    queue_push(reactor, node);
+
+    uint64_t one = 1;
+    ssize_t ignored = write(reactor->wakeFd, &one, sizeof(one));
+    (void)ignored;
+    return true;
+}
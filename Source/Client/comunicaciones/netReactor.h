@@ -0,0 +1,95 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef NET_REACTOR_H
+#define NET_REACTOR_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+#include "socketServer.h"
+#include "frameReader.h"
+
+/*
+ * Header: Net Reactor
+ * Hilo único de entrada/salida basado en epoll que es dueño del socket del cliente.
+ *
+ *   - Conecta de forma no bloqueante y reintenta con espera exponencial
+ *     (NET_REACTOR_BACKOFF_MIN_MS hasta NET_REACTOR_BACKOFF_MAX_MS).
+ *   - Los demás hilos encolan mensajes con `NetReactor_send` en una cola MPSC sin locks y
+ *     despiertan al reactor con un eventfd; el reactor los envía juntos con `SocketServer_sendv`.
+ *   - Lo recibido se lee directo al buffer circular de un `FrameReader` y se entrega al callback
+ *     registrado un mensaje completo por llamada, desde el hilo del reactor.
+ */
+
+#define NET_REACTOR_BACKOFF_MIN_MS 250
+#define NET_REACTOR_BACKOFF_MAX_MS 8000
+#define NET_REACTOR_MAX_QUEUED_BYTES (4 * 1024 * 1024)  // Tope de mensajes pendientes sin conexión
+
+typedef void (*NetReactorDataCallback)(void *context, char *data, size_t length);
+
+typedef enum {
+    NET_DISCONNECTED,
+    NET_CONNECTING,
+    NET_CONNECTED
+} NetReactorState;
+
+// Mensaje pendiente de envío; el delimitador (o prefijo de longitud) ya viene incluido en `data`
+typedef struct OutboundMessage {
+    _Atomic(struct OutboundMessage *) next;  // Enlace de la cola MPSC
+    struct OutboundMessage *outNext;         // Enlace de la lista de salida (sólo el reactor)
+    size_t length;
+    char data[];
+} OutboundMessage;
+
+typedef struct {
+    SocketServer *socket;
+    int epollFd;
+    int wakeFd;
+    pthread_t thread;
+    atomic_bool running;
+    bool started;
+
+    // Cola MPSC (productores: cualquier hilo; consumidor: el reactor)
+    _Atomic(OutboundMessage *) head;
+    OutboundMessage *tail;
+    OutboundMessage *stub;
+    atomic_size_t queuedBytes;
+
+    // Mensajes sacados de la cola que aún no se terminan de enviar
+    OutboundMessage *outFirst;
+    OutboundMessage *outLast;
+    size_t outOffset;  // Bytes ya enviados del primer mensaje
+    bool wantWrite;
+
+    FrameReader *reader;  // Reensambla los mensajes recibidos
+    FrameMode mode;
+
+    NetReactorState state;
+    int backoffMs;
+    struct timespec nextAttempt;
+
+    NetReactorDataCallback onData;
+    void *context;
+} NetReactor;
+
+// Constructor y Destructor
+NetReactor *NetReactor_create(SocketServer *socket, FrameMode mode, NetReactorDataCallback onData, void *context);
+void NetReactor_destroy(NetReactor *reactor);
+
+// Métodos de la clase
+bool NetReactor_start(NetReactor *reactor);
+void NetReactor_stop(NetReactor *reactor);
+bool NetReactor_send(NetReactor *reactor, const char *message, size_t length);
+
+#endif // NET_REACTOR_H
@@ -22,6 +22,7 @@ Consulta el archivo LICENSE para más detalles.
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <sys/socket.h>
 #include <log.h>
 
 // Puntero estático para almacenar la única instancia de SocketServer
@@ -75,7 +76,7 @@ SocketServer *SocketServer_create() {
     socketServer_instance->ipServidor = address;  // Apuntando directamente
     log_debug("IP del servidor: %s\n", socketServer_instance->ipServidor);
     socketServer_instance->port= get_config_int("socket.port");
-    socketServer_instance->sock = 0;
+    socketServer_instance->sock = -1;
     socketServer_instance->isConnected = 0;  // El servidor comienza como desconectado
     memset(&(socketServer_instance->serverAddress), 0, sizeof(socketServer_instance->serverAddress));
 
@@ -110,9 +111,7 @@ SocketServer *SocketServer_create() {
 */
 void SocketServer_destroy(SocketServer *server) {
     if (server != NULL) {
-        if (server->sock > 0) {
-            close(server->sock);  // Cerrar el socket si está abierto
-        }
+        SocketServer_close(server);  // Cerrar el socket si está abierto
         free(server);  // Liberar la memoria de la estructura
         socketServer_instance = NULL;
     }
@@ -153,198 +152,202 @@ void SocketServer_configureAddress(SocketServer *server) {
     }
 }
 
-/* Function: SocketServer_start
+/* Function: SocketServer_connect
    Descripción:
-     Crea un socket e intenta conectarse al servidor definido en la instancia del `SocketServer`.
-     Reintenta la conexión en caso de fallo hasta que se establezca exitosamente.
+     Crea un socket no bloqueante e inicia la conexión con el servidor sin esperar a que termine.
+     El reactor de red (`NetReactor`) completa la conexión cuando el socket admite escritura.
 
    Params:
      server - Puntero a la instancia del servidor de sockets (`SocketServer *`) que iniciará la conexión.
 
    Returns:
-     - void: No retorna valores.
+     - int: 0 si la conexión quedó establecida de inmediato, 1 si está en progreso y -1 si falló.
 
    Restriction:
-     - `server` debe estar correctamente inicializado y configurado con `SocketServer_configureAddress`.
+     - Sólo debe llamarlo el hilo del reactor, que es el dueño del socket.
      - La dirección IP y el puerto deben ser válidos.
 
    Example:
-     SocketServer_start(server);
-     // Crea un socket y conecta al servidor.
+     int estado = SocketServer_connect(server);
+     if (estado == 1) {
+         // Esperar EPOLLOUT y llamar a SocketServer_finishConnect
+     }
 
    Problems:
-     - Problema: Si el socket no puede ser creado, se registrará un error crítico y no se establecerá conexión.
-       - Solución: Validar la creación del socket antes de proceder.
-     - Problema: Si la conexión falla repetidamente, puede causar bloqueos en el programa.
-       - Solución: Implementar un límite de reintentos o manejar adecuadamente el tiempo de espera.
+     - Problema: Un `connect` bloqueante detenía al hilo que creaba el servidor mientras el servidor no existiera.
+       - Solución: El socket se crea con `SOCK_NONBLOCK` y el resultado se consulta después.
 
    References:
-     - Ninguna referencia externa específica.
+     - connect: https://man7.org/linux/man-pages/man2/connect.2.html
 */
-void SocketServer_start(SocketServer *server) {
-    if ((server->sock = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+int SocketServer_connect(SocketServer *server) {
+    SocketServer_close(server);
+
+    if ((server->sock = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) < 0) {
         log_fatal("Error al crear el socket\n");
-        return;
+        server->sock = -1;
+        return -1;
     }
 
     SocketServer_configureAddress(server);  // Configurar la dirección del servidor
 
-    // Intentar conectar al servidor
-    while (connect(server->sock, (struct sockaddr *)&(server->serverAddress), sizeof(server->serverAddress)) < 0) {
-        savelog_error("Error al conectar al servidor, reintentando en 1 segundo...\n");
-        sleep(1);
+    if (connect(server->sock, (struct sockaddr *)&(server->serverAddress), sizeof(server->serverAddress)) == 0) {
+        server->isConnected = 1;
+        log_info("Conectado al servidor en el puerto %d\n", ntohs(server->serverAddress.sin_port));
+        return 0;
+    }
+    if (errno == EINPROGRESS || errno == EINTR) {
+        return 1;
     }
 
-    log_info("Conectado al servidor en el puerto %d\n", ntohs(server->serverAddress.sin_port));
-    server->isConnected = 1;  // Marcar como conectado
+    SocketServer_close(server);
+    return -1;
 }
 
-/* Function: SocketServer_send
+/* Function: SocketServer_finishConnect
    Descripción:
-     Envía un mensaje al servidor a través del socket. Si el servidor no está conectado, registra una advertencia.
-     El mensaje se concatena con un delimitador de fin de línea antes de ser enviado.
+     Consulta el resultado de una conexión no bloqueante iniciada con `SocketServer_connect`.
 
    Params:
-     server - Puntero a la instancia del servidor de sockets (`SocketServer *`) que envía el mensaje.
-     message - Cadena de texto que contiene el mensaje a enviar.
+     server - Puntero a la instancia del servidor de sockets (`SocketServer *`).
 
    Returns:
-     - void: No retorna valores.
+     - int: 0 si la conexión se estableció, -1 si falló (el socket queda cerrado).
 
    Restriction:
-     - `server` debe estar correctamente inicializado y conectado al servidor (`isConnected` debe ser `true`).
-     - `message` debe ser una cadena válida y no nula.
+     - Debe llamarse cuando el socket reporte que admite escritura o un error.
 
    Example:
-     SocketServer_send(server, "Hola, servidor");
-     // Envía un mensaje al servidor conectado.
-
-   Problems:
-     - Problema: Si el servidor no está conectado, el mensaje no se enviará.
-       - Solución: Validar el estado de conexión antes de intentar enviar.
-     - Problema: Si ocurre un error durante el envío, los datos pueden no ser enviados completamente.
-       - Solución: Manejar errores y registrar mensajes para depuración.
+     if (SocketServer_finishConnect(server) == 0) {
+         // Conectado
+     }
 
    References:
-     - Ninguna referencia externa específica.
-     */
+     - getsockopt(SO_ERROR): https://man7.org/linux/man-pages/man2/connect.2.html
+*/
+int SocketServer_finishConnect(SocketServer *server) {
+    int error = 0;
+    socklen_t length = sizeof(error);
 
-void SocketServer_send(SocketServer *server, const char *message) {
-    if (!server->isConnected) {
-        log_warn("El servidor no está disponible, no se puede enviar el mensaje.\n");
-        return;
+    if (getsockopt(server->sock, SOL_SOCKET, SO_ERROR, &error, &length) < 0 || error != 0) {
+        SocketServer_close(server);
+        return -1;
     }
 
-    // Concatenar el mensaje con un delimitador de fin de línea.
-    char messageWithDelimiter[8192];  // Ajusta el tamaño si es necesario
-    snprintf(messageWithDelimiter, sizeof(messageWithDelimiter), "%s\n", message);
-
-    size_t totalBytesSent = 0;
-    size_t messageLength = strlen(messageWithDelimiter);
+    log_info("Conectado al servidor en el puerto %d\n", ntohs(server->serverAddress.sin_port));
+    server->isConnected = 1;  // Marcar como conectado
+    return 0;
+}
 
-    // Bucle para enviar todos los datos
-    while (totalBytesSent < messageLength) {
-        ssize_t bytesSent = send(server->sock, messageWithDelimiter + totalBytesSent, messageLength - totalBytesSent, 0);
+/* Function: SocketServer_close
+   Descripción:
+     Cierra el socket si está abierto y marca el servidor como desconectado.
 
-        if (bytesSent < 0) {
-            log_error("Error al enviar el mensaje\n");
-            return;
-        }
+   Params:
+     server - Puntero a la instancia del servidor de sockets (`SocketServer *`).
 
-        totalBytesSent += bytesSent;
+   Returns:
+     - void: No retorna valores.
+*/
+void SocketServer_close(SocketServer *server) {
+    if (server->sock >= 0) {
+        close(server->sock);
     }
-
-    //log_info("Mensaje enviado al servidor: %s\n", message);
+    server->sock = -1;
+    server->isConnected = 0;
 }
 
-/* Function: SocketServer_receive
+/* Function: SocketServer_sendv
    Descripción:
-     Recibe un mensaje del servidor a través del socket y maneja posibles desconexiones.
-     Actualiza el estado de conexión del servidor según sea necesario.
+     Escribe varios bloques de datos en el socket con una sola llamada de dispersión/recolección, sin copiarlos
+     a un buffer intermedio. El reactor la usa para enviar en un solo paso todos los mensajes pendientes.
 
    Params:
-     server - Puntero a la instancia del servidor de sockets (`SocketServer *`) que recibe el mensaje.
-     buffer - Puntero al buffer donde se almacenará el mensaje recibido.
-     bufferSize - Tamaño máximo del buffer.
+     server - Puntero a la instancia del servidor de sockets (`SocketServer *`).
+     parts - Bloques a enviar.
+     count - Cantidad de bloques.
 
    Returns:
-     - int: Cantidad de bytes recibidos si se completa exitosamente.
-       Retorna 0 si el servidor se desconecta, o -1 si ocurre un error.
+     - ssize_t: Bytes aceptados por el kernel (puede ser menos que el total), o -1 con `errno` si falló.
+       `EAGAIN` indica que hay que esperar a que el socket admita escritura.
 
    Restriction:
-     - `server` debe estar correctamente inicializado y conectado al servidor (`isConnected` debe ser `true`).
-     - `buffer` debe ser un puntero válido y el tamaño (`bufferSize`) suficiente para almacenar el mensaje.
+     - Sólo debe llamarlo el hilo del reactor.
 
    Example:
-     char buffer[1024];
-     int bytes = SocketServer_receive(server, buffer, sizeof(buffer));
-     if (bytes > 0) {
-         printf("Mensaje recibido: %s\n", buffer);
-     }
+     struct iovec parts[2] = { { mensaje, largo }, { "\n", 1 } };
+     ssize_t enviados = SocketServer_sendv(server, parts, 2);
 
    Problems:
-     - Problema: Si el servidor se desconecta, el método retorna 0 y marca el servidor como desconectado.
-       - Solución: Manejar el estado de desconexión y reconectar si es necesario.
-     - Problema: Si el buffer no es suficientemente grande, se puede truncar el mensaje recibido.
-       - Solución: Asegurar que el tamaño del buffer sea adecuado.
+     - Problema: Si el servidor cierra la conexión, escribir en el socket generaría `SIGPIPE`.
+       - Solución: Se usa `sendmsg` con `MSG_NOSIGNAL`; `EINTR` se reintenta internamente.
 
    References:
-     - Ninguna referencia externa específica.
+     - sendmsg: https://man7.org/linux/man-pages/man2/sendmsg.2.html
+     - writev: https://man7.org/linux/man-pages/man2/writev.2.html
 */
-int SocketServer_receive(SocketServer *server, char *buffer, int bufferSize) {
-    if (!server->isConnected) {
-        log_warn("El servidor no está disponible, no se puede recibir mensajes.\n");
-        return -1;  // No recibir mensajes si el servidor está desconectado
-    }
+ssize_t SocketServer_sendv(SocketServer *server, const struct iovec *parts, int count) {
+    struct msghdr header = { 0 };
+    header.msg_iov = (struct iovec *)parts;
+    header.msg_iovlen = (size_t)count;
 
-    int valread = read(server->sock, buffer, bufferSize - 1);
+    ssize_t bytesSent;
+    do {
+        bytesSent = sendmsg(server->sock, &header, MSG_NOSIGNAL);
+    } while (bytesSent < 0 && errno == EINTR);
 
-    if (valread == 0) {
-        log_warn("El servidor se ha desconectado\n");
-        server->isConnected = 0;  // Marcar como desconectado
-        return 0;  // Indicar que la conexión se ha cerrado
-    } else if (valread < 0) {
-        if (errno == EWOULDBLOCK || errno == EAGAIN) {
-            return -1;  // Indicar que no hay datos sin error crítico
-        } else {
-            server->isConnected = 0;  // Marcar como desconectado en caso de error
-            return -1;  // Indicar error
-        }
-    } else {
-        buffer[valread] = '\0';  // Añadir terminador de cadena al buffer
-        //log_info("Mensaje recibido del servidor: %s\n", buffer);
-        return valread;  // Retornar la cantidad de bytes leídos
-    }
+    return bytesSent;
 }
 
-/* Function: SocketServer_reconnect
+/* Function: SocketServer_receivev
    Descripción:
-     Intenta reconectar al servidor si está desconectado, utilizando la configuración previa.
+     Lee los datos disponibles en el socket (no bloqueante) directamente sobre varias regiones de memoria,
+     por ejemplo las dos partes libres de un buffer circular. No agrega terminador.
 
    Params:
-     server - Puntero a la instancia del servidor de sockets (`SocketServer *`) que intentará reconectarse.
+     server - Puntero a la instancia del servidor de sockets (`SocketServer *`).
+     parts - Regiones donde se escriben los datos, en orden.
+     count - Cantidad de regiones.
 
    Returns:
-     - void: No retorna valores.
+     - ssize_t: Bytes recibidos, 0 si el servidor cerró la conexión, o -1 con `errno` en `EAGAIN` si no hay datos.
 
    Restriction:
-     - `server` debe estar correctamente inicializado.
-     - La dirección y el puerto del servidor deben estar configurados correctamente.
-
-   Example:
-     SocketServer_reconnect(server);
-     // Intenta reconectar al servidor si la conexión actual está cerrada.
-
-   Problems:
-     - Problema: Si la conexión falla repetidamente, puede causar un bucle de reconexión continuo.
-       - Solución: Implementar un límite de intentos de reconexión o tiempos de espera adecuados.
+     - El socket debe estar conectado.
 
    References:
-     - Ninguna referencia externa específica.
- */
-void SocketServer_reconnect(SocketServer *server) {
+     - readv: https://man7.org/linux/man-pages/man2/readv.2.html
+*/
+ssize_t SocketServer_receivev(SocketServer *server, const struct iovec *parts, int count) {
     if (!server->isConnected) {
-        log_warn("Intentando reconectar al servidor...\n");
-        SocketServer_start(server);  // Intentar reconectar
+        errno = ENOTCONN;
+        return -1;
+    }
+
+    ssize_t valread;
+    do {
+        valread = readv(server->sock, parts, count);
+    } while (valread < 0 && errno == EINTR);
+
+    if (valread == 0) {
+        log_warn("El servidor se ha desconectado\n");
+        server->isConnected = 0;
+    } else if (valread < 0 && errno != EWOULDBLOCK && errno != EAGAIN) {
+        server->isConnected = 0;
     }
-}
\ No newline at end of file
+    return valread;
+}
+
+/* Function: SocketServer_isConnected
+   Descripción:
+     Indica si el socket está conectado al servidor.
+
+   Params:
+     server - Puntero a la instancia del servidor de sockets (`SocketServer *`).
+
+   Returns:
+     - bool: `true` si hay conexión establecida.
+*/
+bool SocketServer_isConnected(SocketServer *server) {
+    return server != NULL && server->isConnected;
+}
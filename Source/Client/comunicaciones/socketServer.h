@@ -12,11 +12,14 @@ Consulta el archivo LICENSE para más detalles.
 #define SOCKET_SERVER_H
 
 #include <netinet/in.h>
+#include <stdbool.h>
+#include <sys/types.h>
+#include <sys/uio.h>
 
 typedef struct {
     const char* ipServidor;  // Apunta al string de la dirección IP
     int port;               // Cambiar a un puntero para el puerto
-    int sock;               // Descriptor del socket
+    int sock;               // Descriptor del socket (-1 si está cerrado); lo maneja el hilo del reactor
     bool isConnected;       // Bool para conocer si el servidor está activado o no
     struct sockaddr_in serverAddress;  // Dirección del servidor
 } SocketServer;
@@ -26,10 +29,11 @@ SocketServer *SocketServer_create();
 void SocketServer_destroy(SocketServer *server);
 
 // Métodos de la clase
-void SocketServer_start(SocketServer *server);
-void SocketServer_send(SocketServer *server, const char *message);
-int SocketServer_receive(SocketServer *server, char *buffer, int bufferSize);
-void SocketServer_reconnect(SocketServer *server);
+int SocketServer_connect(SocketServer *server);
+int SocketServer_finishConnect(SocketServer *server);
+void SocketServer_close(SocketServer *server);
+ssize_t SocketServer_sendv(SocketServer *server, const struct iovec *parts, int count);
+ssize_t SocketServer_receivev(SocketServer *server, const struct iovec *parts, int count);
 bool SocketServer_isConnected(SocketServer *server);
 
 #endif // SOCKET_SERVER_H
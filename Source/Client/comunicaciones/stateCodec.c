@@ -0,0 +1,769 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "stateCodec.h"
+#include "../logs/saveLog.h"
+#include "../game/Objects/brick.h"
+#include "../game/Objects/ball.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define QUANT_SCALE 4.0f  // 1/4 de pixel
+
+static const char base64Alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Lector con verificación de límites para tramas recibidas
+typedef struct {
+    const uint8_t *data;
+    size_t length;
+    size_t pos;
+    bool ok;
+} ByteReader;
+
+// ============================================================================================================= //
+// UTILIDADES
+
+static int16_t quantize(float value) {
+    long q = lroundf(value * QUANT_SCALE);
+    if (q > INT16_MAX) q = INT16_MAX;
+    if (q < INT16_MIN) q = INT16_MIN;
+    return (int16_t)q;
+}
+
+static uint16_t quantizeSize(float value) {
+    long q = lroundf(value * QUANT_SCALE);
+    if (q < 0) q = 0;
+    if (q > UINT16_MAX) q = UINT16_MAX;
+    return (uint16_t)q;
+}
+
+static size_t maskBytes(int bits) {
+    return (size_t)(bits + 7) / 8;
+}
+
+static bool maskGet(const uint8_t *mask, int index) {
+    return (mask[index >> 3] >> (index & 7)) & 1;
+}
+
+static void maskSet(uint8_t *mask, int index, bool value) {
+    if (value) {
+        mask[index >> 3] |= (uint8_t)(1u << (index & 7));
+    } else {
+        mask[index >> 3] &= (uint8_t)~(1u << (index & 7));
+    }
+}
+
+static uint8_t *putU8(uint8_t *p, uint8_t v) {
+    *p++ = v;
+    return p;
+}
+
+static uint8_t *putU16(uint8_t *p, uint16_t v) {
+    *p++ = (uint8_t)(v & 0xFF);
+    *p++ = (uint8_t)(v >> 8);
+    return p;
+}
+
+static uint8_t *putI32(uint8_t *p, int32_t v) {
+    uint32_t u = (uint32_t)v;
+    *p++ = (uint8_t)(u & 0xFF);
+    *p++ = (uint8_t)((u >> 8) & 0xFF);
+    *p++ = (uint8_t)((u >> 16) & 0xFF);
+    *p++ = (uint8_t)(u >> 24);
+    return p;
+}
+
+static uint8_t getU8(ByteReader *r) {
+    if (!r->ok || r->pos + 1 > r->length) {
+        r->ok = false;
+        return 0;
+    }
+    return r->data[r->pos++];
+}
+
+static uint16_t getU16(ByteReader *r) {
+    if (!r->ok || r->pos + 2 > r->length) {
+        r->ok = false;
+        return 0;
+    }
+    uint16_t v = (uint16_t)(r->data[r->pos] | (r->data[r->pos + 1] << 8));
+    r->pos += 2;
+    return v;
+}
+
+static int32_t getI32(ByteReader *r) {
+    if (!r->ok || r->pos + 4 > r->length) {
+        r->ok = false;
+        return 0;
+    }
+    uint32_t u = (uint32_t)r->data[r->pos]
+                 | ((uint32_t)r->data[r->pos + 1] << 8)
+                 | ((uint32_t)r->data[r->pos + 2] << 16)
+                 | ((uint32_t)r->data[r->pos + 3] << 24);
+    r->pos += 4;
+    return (int32_t)u;
+}
+
+static void getBytes(ByteReader *r, uint8_t *out, size_t n) {
+    if (!r->ok || r->pos + n > r->length) {
+        r->ok = false;
+        return;
+    }
+    memcpy(out, r->data + r->pos, n);
+    r->pos += n;
+}
+
+// ============================================================================================================= //
+// SNAPSHOTS
+
+static bool snapshot_init(StateSnapshot *snap, int rows, int cols, int maxBalls) {
+    memset(snap, 0, sizeof(*snap));
+    snap->rows = rows;
+    snap->cols = cols;
+    snap->maxBalls = maxBalls;
+    snap->ballMask = calloc(maskBytes(maxBalls) + 1, 1);
+    snap->ballX = calloc((size_t)maxBalls + 1, sizeof(int16_t));
+    snap->ballY = calloc((size_t)maxBalls + 1, sizeof(int16_t));
+    snap->brickMask = calloc(maskBytes(rows * cols) + 1, 1);
+    return snap->ballMask && snap->ballX && snap->ballY && snap->brickMask;
+}
+
+static void snapshot_free(StateSnapshot *snap) {
+    free(snap->ballMask);
+    free(snap->ballX);
+    free(snap->ballY);
+    free(snap->brickMask);
+    memset(snap, 0, sizeof(*snap));
+}
+
+static void snapshot_copy(StateSnapshot *dst, const StateSnapshot *src) {
+    dst->playerX = src->playerX;
+    dst->playerY = src->playerY;
+    dst->playerSizeX = src->playerSizeX;
+    dst->playerSizeY = src->playerSizeY;
+    dst->lives = src->lives;
+    dst->score = src->score;
+    dst->levelsCompleted = src->levelsCompleted;
+    dst->flags = src->flags;
+    memcpy(dst->ballMask, src->ballMask, maskBytes(src->maxBalls));
+    memcpy(dst->ballX, src->ballX, (size_t)src->maxBalls * sizeof(int16_t));
+    memcpy(dst->ballY, src->ballY, (size_t)src->maxBalls * sizeof(int16_t));
+    memcpy(dst->brickMask, src->brickMask, maskBytes(src->rows * src->cols));
+}
+
+static void snapshot_captureDynamic(StateSnapshot *snap, const GameState *gameState) {
+    snap->playerX = quantize(gameState->player.position.x);
+    snap->playerY = quantize(gameState->player.position.y);
+    snap->playerSizeX = quantizeSize(gameState->player.size.x);
+    snap->playerSizeY = quantizeSize(gameState->player.size.y);
+    snap->lives = (uint8_t)(gameState->player.life < 0 ? 0 : (gameState->player.life > 255 ? 255 : gameState->player.life));
+    snap->score = gameState->player.score;
+    snap->levelsCompleted = (uint16_t)gameState->levelsCompleted;
+    snap->flags = (gameState->gameOver ? STATE_FLAG_GAME_OVER : 0)
+                  | (gameState->pause ? STATE_FLAG_PAUSED : 0)
+                  | (gameState->winner ? STATE_FLAG_WINNER : 0)
+                  | (gameState->bolaLanzada ? STATE_FLAG_BALL_LAUNCHED : 0);
+
+    memset(snap->ballMask, 0, maskBytes(snap->maxBalls));
+    for (int i = 0; i < snap->maxBalls; i++) {
+        if (ball_is_active(&gameState->balls, i)) {
+            maskSet(snap->ballMask, i, true);
+            snap->ballX[i] = quantize(gameState->balls.x[i]);
+            snap->ballY[i] = quantize(gameState->balls.y[i]);
+        } else {
+            snap->ballX[i] = 0;
+            snap->ballY[i] = 0;
+        }
+    }
+}
+
+static void snapshot_captureBricks(StateSnapshot *snap, const GameState *gameState) {
+    memset(snap->brickMask, 0, maskBytes(snap->rows * snap->cols));
+    const BrickGrid *grid = &gameState->bricks;
+    for (int i = 0; i < snap->rows; i++) {
+        // Sólo se visitan los ladrillos activos: un bit encendido por ladrillo en cada palabra de la fila
+        for (int word = 0; word < grid->wordsPerRow; word++) {
+            for (uint64_t bits = brick_row_bits(grid, i, word); bits != 0; bits &= bits - 1) {
+                maskSet(snap->brickMask, i * snap->cols + word * 64 + __builtin_ctzll(bits), true);
+            }
+        }
+    }
+}
+
+static bool ballsEqual(const StateSnapshot *a, const StateSnapshot *b) {
+    return memcmp(a->ballMask, b->ballMask, maskBytes(a->maxBalls)) == 0
+           && memcmp(a->ballX, b->ballX, (size_t)a->maxBalls * sizeof(int16_t)) == 0
+           && memcmp(a->ballY, b->ballY, (size_t)a->maxBalls * sizeof(int16_t)) == 0;
+}
+
+// Reconstruye la lista de ladrillos que difieren del keyframe recorriendo las máscaras completas
+static void rebuildChangedList(StateEncoder *encoder) {
+    const StateSnapshot *cur = &encoder->current;
+    const StateSnapshot *key = &encoder->key;
+    size_t n = maskBytes(cur->rows * cur->cols);
+    encoder->changedCount = 0;
+    for (size_t k = 0; k < n; k++) {
+        uint8_t diff = cur->brickMask[k] ^ key->brickMask[k];
+        while (diff) {
+            encoder->changed[encoder->changedCount++] = (uint16_t)(k * 8 + __builtin_ctz(diff));
+            diff &= (uint8_t)(diff - 1);
+        }
+    }
+}
+
+// Aplica los ladrillos destruidos registrados en la bitácora sin recorrer el tablero
+static void applyJournal(StateEncoder *encoder, const StateJournal *journal) {
+    StateSnapshot *cur = &encoder->current;
+    for (int e = 0; e < journal->count; e++) {
+        const JournalEvent *event = &journal->events[e];
+        if (event->type != JOURNAL_BRICK_DESTROYED
+            || event->a < 0 || event->a >= cur->rows || event->b < 0 || event->b >= cur->cols) {
+            continue;
+        }
+        int index = event->a * cur->cols + event->b;
+        if (maskGet(cur->brickMask, index)) {
+            maskSet(cur->brickMask, index, false);
+            if (maskGet(encoder->key.brickMask, index)) {
+                encoder->changed[encoder->changedCount++] = (uint16_t)index;
+            }
+        }
+    }
+}
+
+// ============================================================================================================= //
+// ENCODER
+
+/* Function: StateEncoder_create
+   Descripción:
+     Crea un codificador de estado binario para un tablero de `rows` x `cols` ladrillos y `maxBalls` bolas.
+
+   Params:
+     rows - Cantidad de filas de ladrillos.
+     cols - Cantidad de ladrillos por fila.
+     maxBalls - Cantidad máxima de bolas.
+
+   Returns:
+     - StateEncoder*: Codificador listo para usar o `NULL` si no hay memoria.
+
+   Restriction:
+     - `rows` y `cols` deben caber en un byte (<= 255) y `maxBalls` en 16 bits.
+
+   Example:
+     StateEncoder *encoder = StateEncoder_create(8, 8, 5);
+
+   Problems:
+     - Problema: Si falla la asignación de memoria, el codificador no se puede usar.
+       - Solución: Se retorna `NULL` y se registra el error con `savelog_error`.
+
+   References:
+     - Ninguna referencia externa específica.
+*/
+StateEncoder *StateEncoder_create(int rows, int cols, int maxBalls) {
+    if (rows <= 0 || cols <= 0 || rows > 255 || cols > 255 || maxBalls < 0 || maxBalls > UINT16_MAX) {
+        savelog_error("Dimensiones inválidas para el codificador de estado\n");
+        return NULL;
+    }
+
+    StateEncoder *encoder = calloc(1, sizeof(StateEncoder));
+    if (encoder == NULL) {
+        savelog_error("Error al asignar memoria para StateEncoder\n");
+        return NULL;
+    }
+
+    encoder->capacity = STATE_CODEC_HEADER_SIZE + 4 + 4 + 7
+                        + maskBytes(maxBalls) + 4 * (size_t)maxBalls
+                        + maskBytes(rows * cols) + 2;
+    encoder->buffer = malloc(encoder->capacity);
+    encoder->changed = malloc((size_t)rows * cols * sizeof(uint16_t));
+
+    if (encoder->buffer == NULL || encoder->changed == NULL
+        || !snapshot_init(&encoder->key, rows, cols, maxBalls)
+        || !snapshot_init(&encoder->current, rows, cols, maxBalls)) {
+        savelog_error("Error al asignar memoria para StateEncoder\n");
+        StateEncoder_destroy(encoder);
+        return NULL;
+    }
+    return encoder;
+}
+
+/* Function: StateEncoder_destroy
+   Descripción:
+     Libera el codificador y sus buffers.
+
+   Params:
+     encoder - Codificador a liberar (puede ser `NULL`).
+*/
+void StateEncoder_destroy(StateEncoder *encoder) {
+    if (encoder == NULL) return;
+    snapshot_free(&encoder->key);
+    snapshot_free(&encoder->current);
+    free(encoder->changed);
+    free(encoder->buffer);
+    free(encoder);
+}
+
+/* Function: StateEncoder_forceKeyframe
+   Descripción:
+     Obliga a que la próxima trama codificada sea un keyframe, por ejemplo al reiniciar la partida.
+
+   Params:
+     encoder - Codificador a modificar.
+*/
+void StateEncoder_forceKeyframe(StateEncoder *encoder) {
+    if (encoder != NULL) {
+        encoder->hasKey = false;
+    }
+}
+
+/* Function: StateEncoder_encode
+   Descripción:
+     Codifica el estado actual del juego como keyframe o como delta contra el último keyframe.
+     Se emite un keyframe cuando no existe uno previo, cada `STATE_CODEC_KEYFRAME_INTERVAL` tramas,
+     o cuando la lista de ladrillos cambiados ocuparía más que la máscara completa.
+
+   Params:
+     encoder - Codificador creado con las dimensiones del `gameState`.
+     gameState - Estado del juego a codificar.
+     journal - Cambios registrados desde la trama anterior, o `NULL` para recorrer el tablero completo.
+     frame - Salida: puntero a la trama codificada (propiedad del codificador, válida hasta la próxima llamada).
+
+   Returns:
+     - size_t: Longitud en bytes de la trama.
+
+   Restriction:
+     - Las dimensiones del `gameState` deben coincidir con las usadas en `StateEncoder_create`.
+
+   Example:
+     const uint8_t *frame;
+     size_t length = StateEncoder_encode(encoder, gameState, &localJournal, &frame);
+
+   Problems:
+     - Problema: Un delta se vuelve inútil si el espectador no recibió el keyframe.
+       - Solución: Los keyframes se repiten periódicamente y los deltas indican el keyframe del que dependen.
+     - Problema: Recorrer todo el tablero en cada envío cuesta `linesOfBricks * bricksPerLine`.
+       - Solución: Con la bitácora sólo se procesan los ladrillos destruidos; el tablero se recorre únicamente
+         al iniciar o cuando la bitácora pide una sincronización completa.
+
+   References:
+     - Ninguna referencia externa específica.
+*/
+size_t StateEncoder_encode(StateEncoder *encoder, const GameState *gameState, const StateJournal *journal,
+                           const uint8_t **frame) {
+    StateSnapshot *cur = &encoder->current;
+    StateSnapshot *key = &encoder->key;
+    snapshot_captureDynamic(cur, gameState);
+
+    if (journal == NULL || journal->fullSync || !encoder->hasKey) {
+        snapshot_captureBricks(cur, gameState);
+        rebuildChangedList(encoder);
+    } else {
+        applyJournal(encoder, journal);
+    }
+
+    int brickChanges = encoder->hasKey ? encoder->changedCount : 0;
+    bool isKey = !encoder->hasKey
+                 || encoder->framesSinceKey >= STATE_CODEC_KEYFRAME_INTERVAL
+                 || (size_t)(2 + 2 * brickChanges) >= maskBytes(cur->rows * cur->cols);
+
+    uint8_t sections = STATE_SECTION_ALL;
+    if (!isKey) {
+        sections = 0;
+        if (cur->playerX != key->playerX || cur->playerY != key->playerY) sections |= STATE_SECTION_PLAYER_POS;
+        if (cur->playerSizeX != key->playerSizeX || cur->playerSizeY != key->playerSizeY) sections |= STATE_SECTION_PLAYER_SIZE;
+        if (cur->lives != key->lives || cur->score != key->score || cur->levelsCompleted != key->levelsCompleted) {
+            sections |= STATE_SECTION_STATS;
+        }
+        if (!ballsEqual(cur, key)) sections |= STATE_SECTION_BALLS;
+        if (brickChanges > 0) sections |= STATE_SECTION_BRICKS;
+    }
+
+    uint16_t seq = encoder->seq++;
+    uint16_t keySeq = isKey ? seq : encoder->keySeq;
+
+    // Encabezado
+    uint8_t *p = encoder->buffer;
+    p = putU8(p, STATE_CODEC_VERSION);
+    p = putU8(p, isKey ? STATE_FRAME_KEY : STATE_FRAME_DELTA);
+    p = putU16(p, seq);
+    p = putU16(p, keySeq);
+    p = putU8(p, (uint8_t)cur->rows);
+    p = putU8(p, (uint8_t)cur->cols);
+    p = putU16(p, (uint16_t)cur->maxBalls);
+    p = putU8(p, cur->flags);
+    p = putU8(p, sections);
+
+    if (sections & STATE_SECTION_PLAYER_POS) {
+        p = putU16(p, (uint16_t)cur->playerX);
+        p = putU16(p, (uint16_t)cur->playerY);
+    }
+    if (sections & STATE_SECTION_PLAYER_SIZE) {
+        p = putU16(p, cur->playerSizeX);
+        p = putU16(p, cur->playerSizeY);
+    }
+    if (sections & STATE_SECTION_STATS) {
+        p = putU8(p, cur->lives);
+        p = putI32(p, cur->score);
+        p = putU16(p, cur->levelsCompleted);
+    }
+    if (sections & STATE_SECTION_BALLS) {
+        memcpy(p, cur->ballMask, maskBytes(cur->maxBalls));
+        p += maskBytes(cur->maxBalls);
+        for (int i = 0; i < cur->maxBalls; i++) {
+            if (maskGet(cur->ballMask, i)) {
+                p = putU16(p, (uint16_t)cur->ballX[i]);
+                p = putU16(p, (uint16_t)cur->ballY[i]);
+            }
+        }
+    }
+    if (sections & STATE_SECTION_BRICKS) {
+        size_t n = maskBytes(cur->rows * cur->cols);
+        if (isKey) {
+            memcpy(p, cur->brickMask, n);
+            p += n;
+        } else {
+            p = putU16(p, (uint16_t)brickChanges);
+            for (int k = 0; k < brickChanges; k++) {
+                p = putU16(p, encoder->changed[k]);
+            }
+        }
+    }
+
+    if (isKey) {
+        snapshot_copy(key, cur);
+        encoder->changedCount = 0;
+        encoder->keySeq = seq;
+        encoder->hasKey = true;
+        encoder->framesSinceKey = 0;
+    } else {
+        encoder->framesSinceKey++;
+    }
+
+    *frame = encoder->buffer;
+    return (size_t)(p - encoder->buffer);
+}
+
+// ============================================================================================================= //
+// DECODER
+
+/* Function: StateDecoder_create
+   Descripción:
+     Crea un decodificador de estado. Las dimensiones se toman del encabezado del primer keyframe recibido.
+
+   Returns:
+     - StateDecoder*: Decodificador o `NULL` si no hay memoria.
+*/
+StateDecoder *StateDecoder_create() {
+    StateDecoder *decoder = calloc(1, sizeof(StateDecoder));
+    if (decoder == NULL) {
+        savelog_error("Error al asignar memoria para StateDecoder\n");
+    }
+    return decoder;
+}
+
+/* Function: StateDecoder_destroy
+   Descripción:
+     Libera el decodificador y sus buffers.
+
+   Params:
+     decoder - Decodificador a liberar (puede ser `NULL`).
+*/
+void StateDecoder_destroy(StateDecoder *decoder) {
+    if (decoder == NULL) return;
+    snapshot_free(&decoder->key);
+    snapshot_free(&decoder->current);
+    free(decoder);
+}
+
+static void readSections(ByteReader *r, StateSnapshot *snap, uint8_t sections, bool isKey) {
+    if (sections & STATE_SECTION_PLAYER_POS) {
+        snap->playerX = (int16_t)getU16(r);
+        snap->playerY = (int16_t)getU16(r);
+    }
+    if (sections & STATE_SECTION_PLAYER_SIZE) {
+        snap->playerSizeX = getU16(r);
+        snap->playerSizeY = getU16(r);
+    }
+    if (sections & STATE_SECTION_STATS) {
+        snap->lives = getU8(r);
+        snap->score = getI32(r);
+        snap->levelsCompleted = getU16(r);
+    }
+    if (sections & STATE_SECTION_BALLS) {
+        getBytes(r, snap->ballMask, maskBytes(snap->maxBalls));
+        for (int i = 0; i < snap->maxBalls && r->ok; i++) {
+            if (maskGet(snap->ballMask, i)) {
+                snap->ballX[i] = (int16_t)getU16(r);
+                snap->ballY[i] = (int16_t)getU16(r);
+            } else {
+                snap->ballX[i] = 0;
+                snap->ballY[i] = 0;
+            }
+        }
+    }
+    if (sections & STATE_SECTION_BRICKS) {
+        int total = snap->rows * snap->cols;
+        if (isKey) {
+            getBytes(r, snap->brickMask, maskBytes(total));
+        } else {
+            uint16_t count = getU16(r);
+            for (uint16_t k = 0; k < count && r->ok; k++) {
+                uint16_t index = getU16(r);
+                if (index >= total) {
+                    r->ok = false;
+                    break;
+                }
+                maskSet(snap->brickMask, index, !maskGet(snap->brickMask, index));
+            }
+        }
+    }
+}
+
+/* Function: StateDecoder_decode
+   Descripción:
+     Decodifica una trama binaria. Un keyframe reemplaza el estado de referencia; un delta se aplica sobre
+     el keyframe indicado en su encabezado. Los deltas que dependen de un keyframe no recibido se descartan.
+
+   Params:
+     decoder - Decodificador.
+     frame - Bytes de la trama.
+     length - Longitud de la trama.
+
+   Returns:
+     - bool: `true` si la trama produjo un estado nuevo, `false` si se descartó.
+
+   Restriction:
+     - `frame` debe apuntar a `length` bytes válidos.
+
+   Example:
+     if (StateDecoder_decode(decoder, frame, length)) {
+         StateDecoder_applyTo(decoder, gameState);
+     }
+
+   Problems:
+     - Problema: Una trama truncada o corrupta podría dejar el estado a medias.
+       - Solución: Se decodifica sobre una copia y sólo se acepta si la lectura fue completa.
+
+   References:
+     - Ninguna referencia externa específica.
+*/
+bool StateDecoder_decode(StateDecoder *decoder, const uint8_t *frame, size_t length) {
+    ByteReader r = { frame, length, 0, true };
+
+    uint8_t version = getU8(&r);
+    uint8_t type = getU8(&r);
+    uint16_t seq = getU16(&r);
+    uint16_t keySeq = getU16(&r);
+    int rows = getU8(&r);
+    int cols = getU8(&r);
+    int maxBalls = getU16(&r);
+    uint8_t flags = getU8(&r);
+    uint8_t sections = getU8(&r);
+    (void)seq;
+
+    if (!r.ok || version != STATE_CODEC_VERSION) {
+        return false;
+    }
+
+    // Si cambian las dimensiones del tablero se descarta la referencia anterior
+    if (decoder->key.brickMask == NULL || rows != decoder->key.rows || cols != decoder->key.cols
+        || maxBalls != decoder->key.maxBalls) {
+        snapshot_free(&decoder->key);
+        snapshot_free(&decoder->current);
+        decoder->hasKey = false;
+        if (!snapshot_init(&decoder->key, rows, cols, maxBalls)
+            || !snapshot_init(&decoder->current, rows, cols, maxBalls)) {
+            savelog_error("Error al asignar memoria para el decodificador de estado\n");
+            snapshot_free(&decoder->key);
+            snapshot_free(&decoder->current);
+            return false;
+        }
+    }
+
+    if (type == STATE_FRAME_KEY) {
+        if (sections != STATE_SECTION_ALL) return false;
+        snapshot_copy(&decoder->current, &decoder->key);
+        decoder->current.flags = flags;
+        readSections(&r, &decoder->current, sections, true);
+        if (!r.ok) return false;
+        snapshot_copy(&decoder->key, &decoder->current);
+        decoder->keySeq = keySeq;
+        decoder->hasKey = true;
+        return true;
+    }
+
+    if (type == STATE_FRAME_DELTA) {
+        if (!decoder->hasKey || keySeq != decoder->keySeq) {
+            return false;  // Esperar al próximo keyframe
+        }
+        snapshot_copy(&decoder->current, &decoder->key);
+        decoder->current.flags = flags;
+        readSections(&r, &decoder->current, sections, false);
+        if (!r.ok) {
+            snapshot_copy(&decoder->current, &decoder->key);
+            return false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/* Function: StateDecoder_applyTo
+   Descripción:
+     Copia el último estado decodificado al `GameState` local. Si las dimensiones locales no coinciden
+     con las del emisor, sólo se copia la parte común.
+
+   Params:
+     decoder - Decodificador con un estado válido.
+     gameState - Estado del juego a actualizar.
+
+   Restriction:
+     - Si `gameState` es el estado del juego, sólo desde la simulación con su mutex tomado.
+*/
+void StateDecoder_applyTo(const StateDecoder *decoder, GameState *gameState) {
+    if (!decoder->hasKey) return;
+    const StateSnapshot *snap = &decoder->current;
+
+    gameState->player.position.x = snap->playerX / QUANT_SCALE;
+    gameState->player.position.y = snap->playerY / QUANT_SCALE;
+    gameState->player.size.x = snap->playerSizeX / QUANT_SCALE;
+    gameState->player.size.y = snap->playerSizeY / QUANT_SCALE;
+    gameState->player.life = snap->lives;
+    gameState->player.score = snap->score;
+    gameState->levelsCompleted = snap->levelsCompleted;
+    gameState->gameOver = (snap->flags & STATE_FLAG_GAME_OVER) != 0;
+    gameState->pause = (snap->flags & STATE_FLAG_PAUSED) != 0;
+    gameState->winner = (snap->flags & STATE_FLAG_WINNER) != 0;
+    gameState->bolaLanzada = (snap->flags & STATE_FLAG_BALL_LAUNCHED) != 0;
+
+    int balls = snap->maxBalls < gameState->maxBalls ? snap->maxBalls : gameState->maxBalls;
+    for (int i = 0; i < balls; i++) {
+        bool active = maskGet(snap->ballMask, i);
+        ball_set_active(&gameState->balls, i, active);
+        if (active) {
+            ball_set_position(&gameState->balls, i, (Vector2){ snap->ballX[i] / QUANT_SCALE, snap->ballY[i] / QUANT_SCALE });
+        } else {
+            // Las bolas inactivas descansan sobre la raqueta, igual que en update_ball_positions
+            ball_set_position(&gameState->balls, i, (Vector2){ gameState->player.position.x, screenHeight * 7 / 8 - 30 });
+        }
+    }
+
+    int rows = snap->rows < gameState->linesOfBricks ? snap->rows : gameState->linesOfBricks;
+    int cols = snap->cols < gameState->bricksPerLine ? snap->cols : gameState->bricksPerLine;
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            brick_set_active(&gameState->bricks, i, j, maskGet(snap->brickMask, i * snap->cols + j));
+        }
+    }
+}
+
+// ============================================================================================================= //
+// ENVOLTURA DE TEXTO
+
+/* Function: StateCodec_createMessage
+   Descripción:
+     Envuelve una trama binaria en el protocolo de líneas JSON existente usando base64:
+     {"command":"sendGameStateBin","data":"..."}.
+
+   Params:
+     frame - Bytes de la trama.
+     length - Longitud de la trama.
+
+   Returns:
+     - char*: Mensaje listo para `ComServer_sendStatus`, o `NULL` si no hay memoria.
+       El llamador (o `ComServer_sendStatus`) debe liberarlo con `free`.
+
+   Example:
+     char *message = StateCodec_createMessage(frame, length);
+     ComServer_sendStatus(message);
+*/
+char *StateCodec_createMessage(const uint8_t *frame, size_t length) {
+    static const char prefix[] = "{\"command\":\"" STATE_CODEC_COMMAND "\",\"data\":\"";
+    static const char suffix[] = "\"}";
+    size_t encodedLength = 4 * ((length + 2) / 3);
+    char *message = malloc(sizeof(prefix) - 1 + encodedLength + sizeof(suffix));
+    if (message == NULL) {
+        savelog_error("Error al asignar memoria para el mensaje de estado\n");
+        return NULL;
+    }
+
+    char *out = message;
+    memcpy(out, prefix, sizeof(prefix) - 1);
+    out += sizeof(prefix) - 1;
+
+    size_t i = 0;
+    for (; i + 2 < length; i += 3) {
+        uint32_t v = ((uint32_t)frame[i] << 16) | ((uint32_t)frame[i + 1] << 8) | frame[i + 2];
+        *out++ = base64Alphabet[(v >> 18) & 0x3F];
+        *out++ = base64Alphabet[(v >> 12) & 0x3F];
+        *out++ = base64Alphabet[(v >> 6) & 0x3F];
+        *out++ = base64Alphabet[v & 0x3F];
+    }
+    if (i < length) {
+        uint32_t v = (uint32_t)frame[i] << 16;
+        if (i + 1 < length) v |= (uint32_t)frame[i + 1] << 8;
+        *out++ = base64Alphabet[(v >> 18) & 0x3F];
+        *out++ = base64Alphabet[(v >> 12) & 0x3F];
+        *out++ = (i + 1 < length) ? base64Alphabet[(v >> 6) & 0x3F] : '=';
+        *out++ = '=';
+    }
+
+    memcpy(out, suffix, sizeof(suffix));
+    return message;
+}
+
+static int base64Value(char c) {
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+/* Function: StateCodec_base64Decode
+   Descripción:
+     Decodifica texto base64 hasta encontrar una comilla, el relleno '=' o el final del texto.
+
+   Params:
+     text - Texto base64 (por ejemplo, el valor del campo "data").
+     textLength - Longitud máxima a leer.
+     out - Buffer de salida.
+     outCapacity - Capacidad del buffer de salida.
+
+   Returns:
+     - size_t: Cantidad de bytes decodificados (0 si el buffer de salida es insuficiente).
+*/
+size_t StateCodec_base64Decode(const char *text, size_t textLength, uint8_t *out, size_t outCapacity) {
+    uint32_t acc = 0;
+    int bits = 0;
+    size_t written = 0;
+
+    for (size_t i = 0; i < textLength; i++) {
+        char c = text[i];
+        if (c == '"' || c == '=' || c == '\0') break;
+        int v = base64Value(c);
+        if (v < 0) continue;
+        acc = (acc << 6) | (uint32_t)v;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            if (written >= outCapacity) return 0;
+            out[written++] = (uint8_t)((acc >> bits) & 0xFF);
+        }
+    }
+    return written;
+}
@@ -0,0 +1,126 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef STATE_CODEC_H
+#define STATE_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "../game_status.h"
+
+/*
+ * Header: State Codec
+ * Formato binario compacto para transmitir el estado del juego a los espectadores.
+ *
+ * Cada trama inicia con un encabezado fijo de 12 bytes (little endian):
+ *   - version (u8), tipo (u8: KEY o DELTA), seq (u16), keySeq (u16),
+ *     filas (u8), columnas (u8), maxBalls (u16), flags (u8), secciones (u8).
+ *
+ * Luego vienen únicamente las secciones marcadas en el byte de secciones:
+ *   - PLAYER_POS: posición de la raqueta (i16 x, i16 y) cuantizada a 1/4 de pixel.
+ *   - PLAYER_SIZE: tamaño de la raqueta (u16 x, u16 y) cuantizado a 1/4 de pixel.
+ *   - STATS: vidas (u8), puntaje (i32), niveles completados (u16).
+ *   - BALLS: máscara de bolas activas y posición (i16 x, i16 y) de cada bola activa.
+ *   - BRICKS: en un keyframe, la máscara completa de ladrillos activos (1 bit por ladrillo);
+ *             en un delta, la cantidad (u16) y los índices (u16) de los ladrillos que difieren del keyframe.
+ *
+ * Los deltas siempre se calculan contra el último keyframe (identificado por keySeq), nunca contra el delta
+ * anterior, de modo que perder un delta no corrompe los siguientes.
+ *
+ * El codificador mantiene su copia del tablero a partir de la bitácora de cambios (`StateJournal`), así que
+ * sólo recorre el tablero completo cuando la bitácora pide una sincronización completa.
+ *
+ * Las tramas viajan dentro del protocolo de líneas existente como
+ * {"command":"sendGameStateBin","data":"<base64>"}.
+ */
+
+#define STATE_CODEC_VERSION 1
+#define STATE_CODEC_HEADER_SIZE 12
+#define STATE_CODEC_KEYFRAME_INTERVAL 20   // Un keyframe por segundo a 20 estados/s
+#define STATE_CODEC_COMMAND "sendGameStateBin"
+
+typedef enum {
+    STATE_FRAME_KEY = 1,
+    STATE_FRAME_DELTA = 2
+} StateFrameType;
+
+// Secciones presentes en una trama
+#define STATE_SECTION_PLAYER_POS  0x01
+#define STATE_SECTION_PLAYER_SIZE 0x02
+#define STATE_SECTION_STATS       0x04
+#define STATE_SECTION_BALLS       0x08
+#define STATE_SECTION_BRICKS      0x10
+#define STATE_SECTION_ALL         0x1F
+
+// Flags generales del juego
+#define STATE_FLAG_GAME_OVER    0x01
+#define STATE_FLAG_PAUSED       0x02
+#define STATE_FLAG_WINNER       0x04
+#define STATE_FLAG_BALL_LAUNCHED 0x08
+
+// Estado del juego ya cuantizado, tal como viaja por la red
+typedef struct {
+    int rows;
+    int cols;
+    int maxBalls;
+    int16_t playerX;
+    int16_t playerY;
+    uint16_t playerSizeX;
+    uint16_t playerSizeY;
+    uint8_t lives;
+    int32_t score;
+    uint16_t levelsCompleted;
+    uint8_t flags;
+    uint8_t *ballMask;     // ceil(maxBalls / 8) bytes
+    int16_t *ballX;
+    int16_t *ballY;
+    uint8_t *brickMask;    // ceil(rows * cols / 8) bytes
+} StateSnapshot;
+
+typedef struct {
+    StateSnapshot key;      // Último keyframe enviado
+    StateSnapshot current;  // Estado que se está codificando
+    uint16_t *changed;      // Índices de ladrillos que difieren del keyframe
+    int changedCount;
+    uint16_t seq;
+    uint16_t keySeq;
+    int framesSinceKey;
+    bool hasKey;
+    uint8_t *buffer;
+    size_t capacity;
+} StateEncoder;
+
+typedef struct {
+    StateSnapshot key;      // Último keyframe recibido
+    StateSnapshot current;  // Keyframe + último delta aplicado
+    uint16_t keySeq;
+    bool hasKey;
+} StateDecoder;
+
+// Constructor y Destructor
+StateEncoder *StateEncoder_create(int rows, int cols, int maxBalls);
+void StateEncoder_destroy(StateEncoder *encoder);
+StateDecoder *StateDecoder_create();
+void StateDecoder_destroy(StateDecoder *decoder);
+
+// Métodos de la clase
+void StateEncoder_forceKeyframe(StateEncoder *encoder);
+size_t StateEncoder_encode(StateEncoder *encoder, const GameState *gameState, const StateJournal *journal,
+                           const uint8_t **frame);
+bool StateDecoder_decode(StateDecoder *decoder, const uint8_t *frame, size_t length);
+void StateDecoder_applyTo(const StateDecoder *decoder, GameState *gameState);
+
+// Envoltura de texto para el protocolo de líneas
+char *StateCodec_createMessage(const uint8_t *frame, size_t length);
+size_t StateCodec_base64Decode(const char *text, size_t textLength, uint8_t *out, size_t outCapacity);
+
+#endif // STATE_CODEC_H
@@ -13,25 +13,25 @@ Consulta el archivo LICENSE para más detalles.
 
 #include "ball.h"
 
+// BIBLIOTECAS EXTERNAS
+#include <string.h>
 
 /* Function: init_balls
    Descripción:
-     Inicializa las propiedades de todas las bolas en el arreglo `Ball`. Configura sus posiciones iniciales,
+     Inicializa las propiedades de todas las bolas de `BallPool`. Configura sus posiciones iniciales,
      velocidad en cero, radio, y estado inactivo.
 
    Params:
-     ball - Puntero al arreglo de bolas que será inicializado.
+     balls - Puntero a las bolas que serán inicializadas.
 
    Returns:
      - void: No retorna valores.
 
    Restriction:
-     - `ball` debe ser un puntero válido a un arreglo de bolas.
-     - Se asume que `game_state->maxBalls` está configurado correctamente.
+     - `balls` debe haberse reservado con `ball_pool_alloc`.
 
    Example:
-     Ball balls[MAX_BALLS];
-     init_balls(balls);
+     init_balls(&gameState->balls);
      // Inicializa las bolas para el juego.
 
    Problems:
@@ -41,14 +41,15 @@ Consulta el archivo LICENSE para más detalles.
    References:
      - Ninguna referencia externa específica.
 */
-void init_balls(Ball* ball) {
+void init_balls(BallPool *balls) {
     GameState *game_state = getGameState();
-    for (int i = 0; i < game_state->maxBalls; i++) {
-        ball[i].position = (Vector2){ screenWidth/2, screenHeight*7/8 };
-        ball[i].speed = (Vector2){ 0, 0 };
-        ball[i].radius = 7;
-        ball[i].active = false;
+    // También el relleno hasta `stride`, para que los lotes SIMD sólo lean valores finitos
+    for (int i = 0; i < balls->stride; i++) {
+        ball_set_position(balls, i, (Vector2){ screenWidth/2, screenHeight*7/8 });
+        ball_set_speed(balls, i, (Vector2){ 0, 0 });
+        balls->radius[i] = 7;
     }
+    memset(balls->active, 0, (size_t)balls->words * sizeof(uint64_t));
     game_state->bolaLanzada=false;
 }
 
@@ -59,7 +60,8 @@ void init_balls(Ball* ball) {
      Activa una bola específica en el juego, configurando su posición, velocidad y estado activo.
 
    Params:
-     ball - Puntero a la bola que será activada.
+     balls - Puntero a las bolas del juego.
+     i - Índice de la bola que será activada.
      position - Posición inicial de la bola.
      speed - Velocidad inicial de la bola.
 
@@ -67,33 +69,32 @@ void init_balls(Ball* ball) {
      - void: No retorna valores.
 
    Restriction:
-     - `ball` debe ser un puntero válido a una estructura `Ball`.
+     - `i` debe ser menor que `balls->capacity`.
 
    Example:
-     activate_ball(&balls[0], (Vector2){100, 200}, (Vector2){2, -3});
+     activate_ball(&gameState->balls, 0, (Vector2){100, 200}, (Vector2){2, -3});
      // Activa la primera bola con posición y velocidad iniciales.
 
    Problems:
-     - Problema: Si `ball` es nulo, no se podrá realizar la activación.
+     - Problema: Si `balls` es nulo, no se podrá realizar la activación.
        - Solución: Validar el puntero antes de proceder.
 
    References:
      - Ninguna referencia externa específica.
 */
-void activate_ball(Ball* ball, const Vector2 position, const Vector2 speed) {
-    ball->position = position;
-    ball->speed = speed;
-    ball->active = true;
+void activate_ball(BallPool *balls, int i, const Vector2 position, const Vector2 speed) {
+    ball_set_position(balls, i, position);
+    ball_set_speed(balls, i, speed);
+    ball_set_active(balls, i, true);
 }
 
 
 /* Function: noBallsActive
    Descripción:
-     Verifica si todas las bolas en el arreglo están inactivas.
+     Verifica si todas las bolas están inactivas, revisando las palabras de bits de actividad.
 
    Params:
-     balls - Puntero al arreglo de bolas.
-     maxBalls - Número máximo de bolas en el arreglo.
+     balls - Puntero a las bolas del juego.
 
    Returns:
      - bool: `true` si no hay bolas activas, `false` si al menos una está activa.
@@ -102,7 +103,7 @@ void activate_ball(Ball* ball, const Vector2 position, const Vector2 speed) {
      - `balls` debe ser un puntero válido.
 
    Example:
-     if (noBallsActive(balls, MAX_BALLS)) {
+     if (noBallsActive(&gameState->balls)) {
          printf("No hay bolas activas en el juego.\n");
      }
 
@@ -114,9 +115,9 @@ void activate_ball(Ball* ball, const Vector2 position, const Vector2 speed) {
      - Ninguna referencia externa específica.
 */
 
-bool noBallsActive(Ball *balls, int maxBalls) {
-    for (int i = 0; i < maxBalls; i++) {
-        if (balls[i].active) {
+bool noBallsActive(const BallPool *balls) {
+    for (int w = 0; w < balls->words; w++) {
+        if (balls->active[w] != 0) {
             return false; // Hay al menos una bola activa
         }
     }
@@ -126,22 +127,23 @@ bool noBallsActive(Ball *balls, int maxBalls) {
 
 /* Function: update_ball_positions
 Descripción:
-Actualiza las posiciones de las bolas activas según su velocidad. Si la bola está inactiva,
-la posiciona en la raqueta del jugador. También permite el lanzamiento de la primera bola al presionar una tecla.
+Coloca las bolas inactivas sobre la raqueta del jugador y lanza la primera bola si la entrada del paso lo
+pide. Las bolas activas las mueve `handle_collisions`, que avanza cada bola junto con sus colisiones.
 
 Params:
 player - Puntero a la estructura del jugador que sirve de referencia para las bolas inactivas.
-balls - Puntero al arreglo de bolas que será actualizado.
+balls - Puntero a las bolas que serán actualizadas.
+input - Entrada del jugador para este paso.
 
 Returns:
 - void: No retorna valores.
 
 Restriction:
 - `player` y `balls` deben ser punteros válidos.
-- Se asume que `KEY_W` está configurado para el lanzamiento de la bola.
+- `input->launch` debe ser un flanco: si se mantiene activo, cada bola perdida se relanza de inmediato.
 
 Example:
-update_ball_positions(&player, balls);
+update_ball_positions(&player, &gameState->balls, &input);
 // Actualiza las posiciones de las bolas en el juego.
 
 Problems:
@@ -152,21 +154,19 @@ References:
 - Ninguna referencia externa específica.
 */
 
-void update_ball_positions(Player *player, Ball *balls) {
+void update_ball_positions(Player *player, BallPool *balls, const TickInput *input) {
     GameState *game_state = getGameState();
-    for (int i = 0; i < game_state->maxBalls; i++) {
-        if (balls[i].active) {
-            balls[i].position.x += balls[i].speed.x;
-            balls[i].position.y += balls[i].speed.y;
-        } else {
-            balls[i].position = (Vector2){player->position.x, screenHeight * 7 / 8 - 30};
+    for (int i = 0; i < balls->capacity; i++) {
+        if (!ball_is_active(balls, i)) {
+            ball_set_position(balls, i, (Vector2){player->position.x, screenHeight * 7 / 8 - 30});
         }
     }
 
     // Lógica de lanzamiento de la primera bola
-    if (noBallsActive(balls, game_state->maxBalls) && IsKeyPressed(KEY_W)) {
-        balls[0].active = true;
-        balls[0].speed = (Vector2){0, -5*game_state->ball_speed_multiplier};
+    if (noBallsActive(balls) && input->launch) {
+        activate_ball(balls, 0, ball_position(balls, 0),
+                      (Vector2){0, -BALL_SPEED * game_state->ball_speed_multiplier});
         game_state->bolaLanzada=true;
+        StateJournal_record(game_state->journal, JOURNAL_BALL_SPAWN, 0, 0);
     }
 }
\ No newline at end of file
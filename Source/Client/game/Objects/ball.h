@@ -14,13 +14,70 @@ Consulta el archivo LICENSE para más detalles.
 #include <raylib.h>
 #include "../../game_status.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "player.h"
 
-void init_balls(Ball* ball);
-void activate_ball(Ball* ball, Vector2 position, Vector2 speed);
-void update_ball_positions(Player *player, Ball *balls);
+// Velocidad base de las bolas en píxeles por segundo (equivale a los 5 px por paso originales a 60 Hz)
+#define BALL_SPEED 300.0f
 
-bool noBallsActive(Ball *balls, int maxBalls);
+/*
+ * Header: Ball
+ * Bolas del juego (`BallPool`, definido en `game_status.h`).
+ *
+ * Las bolas se guardan como estructura de arreglos para que `ball_kernel_step` mueva varias a la vez
+ * con SIMD (la memoria la reservan `ball_pool_alloc` y `ball_pool_free`, en `game/ballKernel.h`), y la actividad como bits (una palabra de 64 bits por cada 64 bolas). El código que trata
+ * una bola a la vez copia sus campos a un `Ball` con `ball_load` y los devuelve con `ball_store`.
+ *
+ * Accessors:
+ *   - ball_is_active / ball_set_active: Bit de actividad de una bola.
+ *   - ball_position / ball_set_position: Centro de la bola.
+ *   - ball_speed / ball_set_speed: Velocidad de la bola.
+ *   - ball_load / ball_store: Copia de trabajo de una bola.
+ */
+
+static inline bool ball_is_active(const BallPool *pool, int i) {
+    return (pool->active[i / 64] >> (i % 64)) & 1u;
+}
+
+static inline void ball_set_active(BallPool *pool, int i, bool active) {
+    uint64_t bit = (uint64_t)1 << (i % 64);
+    pool->active[i / 64] = active ? (pool->active[i / 64] | bit) : (pool->active[i / 64] & ~bit);
+}
+
+static inline Vector2 ball_position(const BallPool *pool, int i) {
+    return (Vector2){ pool->x[i], pool->y[i] };
+}
+
+static inline void ball_set_position(BallPool *pool, int i, Vector2 position) {
+    pool->x[i] = position.x;
+    pool->y[i] = position.y;
+}
+
+static inline Vector2 ball_speed(const BallPool *pool, int i) {
+    return (Vector2){ pool->speedX[i], pool->speedY[i] };
+}
+
+static inline void ball_set_speed(BallPool *pool, int i, Vector2 speed) {
+    pool->speedX[i] = speed.x;
+    pool->speedY[i] = speed.y;
+}
+
+static inline Ball ball_load(const BallPool *pool, int i) {
+    return (Ball){ ball_position(pool, i), ball_speed(pool, i), (int)pool->radius[i], ball_is_active(pool, i) };
+}
+
+static inline void ball_store(BallPool *pool, int i, const Ball *ball) {
+    ball_set_position(pool, i, ball->position);
+    ball_set_speed(pool, i, ball->speed);
+    pool->radius[i] = (float)ball->radius;
+    ball_set_active(pool, i, ball->active);
+}
+
+void init_balls(BallPool *balls);
+void activate_ball(BallPool *balls, int i, Vector2 position, Vector2 speed);
+void update_ball_positions(Player *player, BallPool *balls, const TickInput *input);
+
+bool noBallsActive(const BallPool *balls);
 
 #endif // BALL_H
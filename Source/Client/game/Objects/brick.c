@@ -13,6 +13,129 @@ Consulta el archivo LICENSE para más detalles.
 
 #include "brick.h"
 
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+
+
+// Desplazamiento de `size` bytes dentro del bloque, alineado a 8 bytes
+static size_t carve(size_t *offset, size_t size) {
+    size_t start = (*offset + 7) & ~(size_t)7;
+    *offset = start + size;
+    return start;
+}
+
+/* Function: brick_grid_alloc
+   Descripción:
+     Reserva los arreglos de un tablero de `rows` x `cols` ladrillos en un solo bloque de memoria, con todos
+     los ladrillos inactivos.
+
+   Params:
+     grid - Tablero a inicializar.
+     rows - Filas de ladrillos.
+     cols - Ladrillos por fila.
+
+   Returns:
+     - bool: `true` si se pudo reservar la memoria.
+
+   Example:
+     if (!brick_grid_alloc(&gameState->bricks, gameState->linesOfBricks, gameState->bricksPerLine)) {
+         exit(EXIT_FAILURE);
+     }
+*/
+bool brick_grid_alloc(BrickGrid *grid, int rows, int cols) {
+    size_t count = (size_t)rows * (size_t)cols;
+    int wordsPerRow = (cols + 63) / 64;
+
+    size_t size = 0;
+    size_t activeAt = carve(&size, (size_t)rows * wordsPerRow * sizeof(uint64_t));
+    size_t positionAt = carve(&size, count * sizeof(Vector2));
+    size_t pointsAt = carve(&size, count * sizeof(int));
+    size_t powerAt = carve(&size, count * sizeof(PowerType));
+    size_t colorAt = carve(&size, count * sizeof(Color));
+
+    char *block = calloc(1, size > 0 ? size : 1);
+    if (block == NULL) {
+        return false;
+    }
+
+    grid->rows = rows;
+    grid->cols = cols;
+    grid->wordsPerRow = wordsPerRow;
+    grid->block = block;
+    grid->active = (uint64_t *)(block + activeAt);
+    grid->position = (Vector2 *)(block + positionAt);
+    grid->points = (int *)(block + pointsAt);
+    grid->power = (PowerType *)(block + powerAt);
+    grid->color = (Color *)(block + colorAt);
+    return true;
+}
+
+/* Function: brick_grid_free
+   Descripción:
+     Libera la memoria del tablero.
+
+   Params:
+     grid - Tablero a liberar.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void brick_grid_free(BrickGrid *grid) {
+    free(grid->block);
+    memset(grid, 0, sizeof(*grid));
+}
+
+/* Function: brick_grid_copy
+   Descripción:
+     Copia todos los campos de un tablero en otro de las mismas dimensiones.
+
+   Params:
+     dst - Tablero de destino, reservado con `brick_grid_alloc`.
+     src - Tablero de origen.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - `dst` y `src` deben tener las mismas filas y columnas.
+*/
+void brick_grid_copy(BrickGrid *dst, const BrickGrid *src) {
+    size_t count = (size_t)src->rows * (size_t)src->cols;
+    memcpy(dst->active, src->active, (size_t)src->rows * src->wordsPerRow * sizeof(uint64_t));
+    memcpy(dst->position, src->position, count * sizeof(Vector2));
+    memcpy(dst->points, src->points, count * sizeof(int));
+    memcpy(dst->power, src->power, count * sizeof(PowerType));
+    memcpy(dst->color, src->color, count * sizeof(Color));
+}
+
+/* Function: bricks_active_count
+   Descripción:
+     Cuenta los ladrillos que siguen en juego sumando los bits de actividad de cada fila.
+
+   Params:
+     grid - Tablero.
+
+   Returns:
+     - int: Cantidad de ladrillos activos.
+
+   Example:
+     if (bricks_active_count(&gameState->bricks) == 0) {
+         gameState->winner = true;
+     }
+
+   References:
+     - GCC Other Builtins (__builtin_popcountll): https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
+*/
+int bricks_active_count(const BrickGrid *grid) {
+    int count = 0;
+    int words = grid->rows * grid->wordsPerRow;
+    for (int w = 0; w < words; w++) {
+        count += __builtin_popcountll(grid->active[w]);
+    }
+    return count;
+}
+
 
 /* Function: init_bricks
    Descripción:
@@ -97,46 +220,47 @@ void init_bricks(GameState* gameState, Vector2 brickSize) {
             color = BEIGE;
         }
 
+        BrickGrid *grid = &gameState->bricks;
         for (int j = 0; j < gameState->bricksPerLine; j++) {
             // Inicializar cada ladrillo en la matriz
-            gameState->bricks[i][j].position = (Vector2){
+            int index = brick_index(grid, i, j);
+            grid->position[index] = (Vector2){
                 j * brickSize.x + brickSize.x / 2,
                 i * brickSize.y + initialDownPosition
             };
-            gameState->bricks[i][j].active = true;
-            gameState->bricks[i][j].power=NONE;
-            gameState->bricks[i][j].points = points;
-            gameState->bricks[i][j].color = color; // Asignar el color correspondiente
+            brick_set_active(grid, i, j, true);
+            grid->power[index] = NONE;
+            grid->points[index] = points;
+            grid->color[index] = color; // Asignar el color correspondiente
         }
     }
+
+    // El tablero completo cambió, los espectadores necesitan una sincronización completa
+    StateJournal_record(gameState->journal, JOURNAL_BOARD_RESET, 0, 0);
 }
 
 /* Function: deactivate_brick
 Descripción:
-Desactiva un ladrillo específico al establecer su estado como inactivo.
+Desactiva un ladrillo específico limpiando su bit de actividad.
 
 Params:
-brick - Puntero a la estructura `Brick` que será desactivada.
+grid - Tablero de ladrillos.
+i - Fila del ladrillo.
+j - Columna del ladrillo.
 
 Returns:
 - void: No retorna valores.
 
 Restriction:
-- `brick` debe ser un puntero válido a una estructura `Brick`.
+- `(i, j)` debe estar dentro del tablero.
 
 Example:
-deactivate_brick(&gameState->bricks[0][0]);
+deactivate_brick(&gameState->bricks, 0, 0);
 // Desactiva el primer ladrillo en la matriz.
 
-Problems:
-- Problema: Si `brick` es nulo, la función no funcionará.
-- Solución: Validar el puntero antes de proceder.
-
 References:
 - Ninguna referencia externa específica.
 */
-void deactivate_brick(Brick* brick) {
-    brick->active = false;
+void deactivate_brick(BrickGrid *grid, int i, int j) {
+    brick_set_active(grid, i, j, false);
 }
-
-
@@ -12,13 +12,55 @@ Consulta el archivo LICENSE para más detalles.
 #define BRICK_H
 
 #include <raylib.h>
+#include <stdbool.h>
+#include <stdint.h>
 
 #include "../../game_status.h"
 
-void init_bricks(GameState* gameState, Vector2 brickSize);
-void deactivate_brick(Brick* brick);
+/*
+ * Header: Brick
+ * Ladrillos del tablero (`BrickGrid`, definido en `game_status.h`).
+ *
+ * Los ladrillos se guardan como estructura de arreglos en un solo bloque de memoria, y la actividad como
+ * bits: una palabra de 64 bits por cada 64 columnas de una fila. Así los recorridos que sólo miran qué
+ * ladrillos siguen en juego (colisiones, dibujo, envío del estado) leen unas pocas palabras por fila, y
+ * "no quedan ladrillos" es contar bits.
+ *
+ * Accessors:
+ *   - brick_index: Índice de (i, j) en los arreglos de campos.
+ *   - brick_is_active / brick_set_active: Bit de actividad de un ladrillo.
+ *   - brick_row_bits: Palabra `word` de los bits de actividad de la fila `i`.
+ *   - brick_position: Centro del ladrillo.
+ */
+
+static inline int brick_index(const BrickGrid *grid, int i, int j) {
+    return i * grid->cols + j;
+}
+
+static inline uint64_t brick_row_bits(const BrickGrid *grid, int i, int word) {
+    return grid->active[i * grid->wordsPerRow + word];
+}
 
+static inline bool brick_is_active(const BrickGrid *grid, int i, int j) {
+    return (grid->active[i * grid->wordsPerRow + j / 64] >> (j % 64)) & 1u;
+}
 
+static inline void brick_set_active(BrickGrid *grid, int i, int j, bool active) {
+    uint64_t bit = (uint64_t)1 << (j % 64);
+    uint64_t *word = &grid->active[i * grid->wordsPerRow + j / 64];
+    *word = active ? (*word | bit) : (*word & ~bit);
+}
 
+static inline Vector2 brick_position(const BrickGrid *grid, int i, int j) {
+    return grid->position[brick_index(grid, i, j)];
+}
+
+bool brick_grid_alloc(BrickGrid *grid, int rows, int cols);
+void brick_grid_free(BrickGrid *grid);
+void brick_grid_copy(BrickGrid *dst, const BrickGrid *src);
+int bricks_active_count(const BrickGrid *grid);
+
+void init_bricks(GameState* gameState, Vector2 brickSize);
+void deactivate_brick(BrickGrid *grid, int i, int j);
 
 #endif // BRICK_H
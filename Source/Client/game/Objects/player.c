@@ -141,12 +141,15 @@ void half_racket(Player* player) {
 
 /* Function: update_player_movement
 Descripción:
-Actualiza la posición del jugador en función de la entrada del teclado. El movimiento
-está limitado al rango de la pantalla.
+Actualiza la posición del jugador en función de la entrada del paso (`TickInput`). La raqueta avanza
+`PLAYER_SPEED` píxeles por segundo y el movimiento está limitado al rango de la pantalla.
 
 Params:
 player - Puntero a la estructura `Player` que será movida.
 screenWidth - Ancho de la pantalla para limitar el movimiento.
+dt - Duración del paso de simulación en segundos.
+input - Entrada del jugador para este paso.
+journal - Bitácora de cambios donde se registra el movimiento de la raqueta.
 
 Returns:
 - void: No retorna valores.
@@ -156,8 +159,8 @@ Restriction:
 - `screenWidth` debe ser mayor a cero.
 
 Example:
-update_player_movement(&player, screenWidth);
-// Mueve al jugador en la dirección indicada por las teclas.
+update_player_movement(&player, screenWidth, gameState->tickSeconds, &input, gameState->journal);
+// Mueve al jugador en la dirección indicada por la entrada.
 
 Problems:
 - Problema: Si `player` es nulo, no se actualizará la posición.
@@ -169,11 +172,17 @@ References:
 - Ninguna referencia externa específica.
 */
 
-void update_player_movement(Player *player, float screenWidth) {
-    if (IsKeyDown(KEY_A)) player->position.x -= 5;
-    if (IsKeyDown(KEY_D)) player->position.x += 5;
+void update_player_movement(Player *player, float screenWidth, float dt, const TickInput *input, StateJournal *journal) {
+    float previousX = player->position.x;
+
+    if (input->moveLeft) player->position.x -= PLAYER_SPEED * dt;
+    if (input->moveRight) player->position.x += PLAYER_SPEED * dt;
 
     // Limitar el movimiento del jugador a la pantalla
     if ((player->position.x - player->size.x / 2) <= 0) player->position.x = player->size.x / 2;
     if ((player->position.x + player->size.x / 2) >= screenWidth) player->position.x = screenWidth - player->size.x / 2;
+
+    if (player->position.x != previousX) {
+        StateJournal_record(journal, JOURNAL_PADDLE_MOVE, 0, 0);
+    }
 }
\ No newline at end of file
@@ -12,12 +12,16 @@ Consulta el archivo LICENSE para más detalles.
 #define PLAYER_H
 
 #include "../../game_status.h"
+#include "../tickInput.h"
+
+// Velocidad de la raqueta en píxeles por segundo
+#define PLAYER_SPEED 300.0f
 
 void init_player(Player* player, int maxLife);
 void updatePlayerScore(Player* player, int points);
 void add_life(Player* player);
 void double_racket(Player* player);
 void half_racket(Player* player);
-void update_player_movement(Player *player, float screenWidth);
+void update_player_movement(Player *player, float screenWidth, float dt, const TickInput *input, StateJournal *journal);
 
 #endif // PLAYER_H
@@ -0,0 +1,306 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "ballKernel.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+
+// Operaciones por carril para cada conjunto de instrucciones. `step_lanes` sólo usa estas funciones,
+// así las tres variantes hacen exactamente las mismas operaciones de punto flotante.
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+#define LANES 8
+typedef __m256 vfloat;
+typedef __m256 vmask;
+
+static inline vfloat v_load(const float *p) { return _mm256_load_ps(p); }
+static inline void v_store(float *p, vfloat v) { _mm256_store_ps(p, v); }
+static inline vfloat v_set(float f) { return _mm256_set1_ps(f); }
+static inline vfloat v_add(vfloat a, vfloat b) { return _mm256_add_ps(a, b); }
+static inline vfloat v_sub(vfloat a, vfloat b) { return _mm256_sub_ps(a, b); }
+static inline vfloat v_mul(vfloat a, vfloat b) { return _mm256_mul_ps(a, b); }
+static inline vfloat v_min(vfloat a, vfloat b) { return _mm256_min_ps(a, b); }
+static inline vfloat v_max(vfloat a, vfloat b) { return _mm256_max_ps(a, b); }
+static inline vmask v_lt(vfloat a, vfloat b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+static inline vmask v_le(vfloat a, vfloat b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+static inline vmask v_and(vmask a, vmask b) { return _mm256_and_ps(a, b); }
+static inline vmask v_or(vmask a, vmask b) { return _mm256_or_ps(a, b); }
+static inline vfloat v_select(vmask m, vfloat a, vfloat b) { return _mm256_blendv_ps(b, a, m); }
+static inline vfloat v_negate_if(vmask m, vfloat v) { return _mm256_xor_ps(v, _mm256_and_ps(m, _mm256_set1_ps(-0.0f))); }
+static inline unsigned v_bits(vmask m) { return (unsigned)_mm256_movemask_ps(m); }
+static inline vmask v_lanes(unsigned bits) {
+    const __m256i lane = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    __m256i set = _mm256_and_si256(_mm256_set1_epi32((int)bits), lane);
+    return _mm256_castsi256_ps(_mm256_cmpeq_epi32(set, lane));
+}
+
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+
+#define LANES 4
+typedef __m128 vfloat;
+typedef __m128 vmask;
+
+static inline vfloat v_load(const float *p) { return _mm_load_ps(p); }
+static inline void v_store(float *p, vfloat v) { _mm_store_ps(p, v); }
+static inline vfloat v_set(float f) { return _mm_set1_ps(f); }
+static inline vfloat v_add(vfloat a, vfloat b) { return _mm_add_ps(a, b); }
+static inline vfloat v_sub(vfloat a, vfloat b) { return _mm_sub_ps(a, b); }
+static inline vfloat v_mul(vfloat a, vfloat b) { return _mm_mul_ps(a, b); }
+static inline vfloat v_min(vfloat a, vfloat b) { return _mm_min_ps(a, b); }
+static inline vfloat v_max(vfloat a, vfloat b) { return _mm_max_ps(a, b); }
+static inline vmask v_lt(vfloat a, vfloat b) { return _mm_cmplt_ps(a, b); }
+static inline vmask v_le(vfloat a, vfloat b) { return _mm_cmple_ps(a, b); }
+static inline vmask v_and(vmask a, vmask b) { return _mm_and_ps(a, b); }
+static inline vmask v_or(vmask a, vmask b) { return _mm_or_ps(a, b); }
+static inline vfloat v_select(vmask m, vfloat a, vfloat b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+static inline vfloat v_negate_if(vmask m, vfloat v) { return _mm_xor_ps(v, _mm_and_ps(m, _mm_set1_ps(-0.0f))); }
+static inline unsigned v_bits(vmask m) { return (unsigned)_mm_movemask_ps(m); }
+static inline vmask v_lanes(unsigned bits) {
+    const __m128i lane = _mm_setr_epi32(1, 2, 4, 8);
+    __m128i set = _mm_and_si128(_mm_set1_epi32((int)bits), lane);
+    return _mm_castsi128_ps(_mm_cmpeq_epi32(set, lane));
+}
+
+#else
+
+#define LANES 1
+typedef float vfloat;
+typedef unsigned vmask;
+
+static inline vfloat v_load(const float *p) { return *p; }
+static inline void v_store(float *p, vfloat v) { *p = v; }
+static inline vfloat v_set(float f) { return f; }
+static inline vfloat v_add(vfloat a, vfloat b) { return a + b; }
+static inline vfloat v_sub(vfloat a, vfloat b) { return a - b; }
+static inline vfloat v_mul(vfloat a, vfloat b) { return a * b; }
+static inline vfloat v_min(vfloat a, vfloat b) { return a < b ? a : b; }
+static inline vfloat v_max(vfloat a, vfloat b) { return a > b ? a : b; }
+static inline vmask v_lt(vfloat a, vfloat b) { return a < b; }
+static inline vmask v_le(vfloat a, vfloat b) { return a <= b; }
+static inline vmask v_and(vmask a, vmask b) { return a & b; }
+static inline vmask v_or(vmask a, vmask b) { return a | b; }
+static inline vfloat v_select(vmask m, vfloat a, vfloat b) { return m ? a : b; }
+static inline vfloat v_negate_if(vmask m, vfloat v) { return m ? -v : v; }
+static inline unsigned v_bits(vmask m) { return m; }
+static inline vmask v_lanes(unsigned bits) { return bits & 1u; }
+
+#endif
+
+#define LANE_BITS ((1u << LANES) - 1u)
+
+#define BALL_POOL_ALIGNMENT 32  // Un registro AVX
+
+// Desplazamiento de `size` bytes dentro del bloque, alineado a BALL_POOL_ALIGNMENT
+static size_t carve(size_t *offset, size_t size) {
+    size_t start = (*offset + BALL_POOL_ALIGNMENT - 1) & ~(size_t)(BALL_POOL_ALIGNMENT - 1);
+    *offset = start + size;
+    return start;
+}
+
+/* Function: ball_pool_alloc
+   Descripción:
+     Reserva los arreglos de `capacity` bolas en un solo bloque de memoria alineado, con todas las bolas
+     inactivas. La capacidad se redondea a BALL_POOL_LANES para que los lotes SIMD no necesiten un
+     tramo final aparte.
+
+   Params:
+     pool - Bolas a inicializar.
+     capacity - Bolas utilizables.
+
+   Returns:
+     - bool: `true` si se pudo reservar la memoria.
+
+   Example:
+     if (!ball_pool_alloc(&gameState->balls, gameState->maxBalls)) {
+         exit(EXIT_FAILURE);
+     }
+*/
+bool ball_pool_alloc(BallPool *pool, int capacity) {
+    int stride = (capacity + BALL_POOL_LANES - 1) / BALL_POOL_LANES * BALL_POOL_LANES;
+    int words = (stride + 63) / 64;
+    size_t lanes = (size_t)stride * sizeof(float);
+
+    size_t size = 0;
+    size_t activeAt = carve(&size, (size_t)words * sizeof(uint64_t));
+    size_t pendingAt = carve(&size, (size_t)words * sizeof(uint64_t));
+    size_t xAt = carve(&size, lanes);
+    size_t yAt = carve(&size, lanes);
+    size_t speedXAt = carve(&size, lanes);
+    size_t speedYAt = carve(&size, lanes);
+    size_t radiusAt = carve(&size, lanes);
+    size = carve(&size, 0);  // aligned_alloc pide un tamaño múltiplo de la alineación
+
+    char *block = aligned_alloc(BALL_POOL_ALIGNMENT, size > 0 ? size : BALL_POOL_ALIGNMENT);
+    if (block == NULL) {
+        return false;
+    }
+    memset(block, 0, size);
+
+    pool->capacity = capacity;
+    pool->stride = stride;
+    pool->words = words;
+    pool->block = block;
+    pool->active = (uint64_t *)(block + activeAt);
+    pool->pending = (uint64_t *)(block + pendingAt);
+    pool->x = (float *)(block + xAt);
+    pool->y = (float *)(block + yAt);
+    pool->speedX = (float *)(block + speedXAt);
+    pool->speedY = (float *)(block + speedYAt);
+    pool->radius = (float *)(block + radiusAt);
+    return true;
+}
+
+/* Function: ball_pool_free
+   Descripción:
+     Libera la memoria de las bolas.
+
+   Params:
+     pool - Bolas a liberar.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void ball_pool_free(BallPool *pool) {
+    free(pool->block);
+    memset(pool, 0, sizeof(*pool));
+}
+
+/* Function: ball_pool_copy
+   Descripción:
+     Copia todas las bolas (también el relleno) en otro `BallPool` de la misma capacidad.
+
+   Params:
+     dst - Bolas de destino, reservadas con `ball_pool_alloc`.
+     src - Bolas de origen.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void ball_pool_copy(BallPool *dst, const BallPool *src) {
+    size_t lanes = (size_t)src->stride * sizeof(float);
+    memcpy(dst->active, src->active, (size_t)src->words * sizeof(uint64_t));
+    memcpy(dst->x, src->x, lanes);
+    memcpy(dst->y, src->y, lanes);
+    memcpy(dst->speedX, src->speedX, lanes);
+    memcpy(dst->speedY, src->speedY, lanes);
+    memcpy(dst->radius, src->radius, lanes);
+}
+
+
+/* Function: step_lanes
+   Descripción:
+     Avanza las bolas [first, first + LANES) un paso y las refleja contra las paredes. Sólo escribe las bolas
+     activas cuyo recorrido cabe por completo en la zona libre (sin ladrillos ni raqueta y con a lo sumo un
+     rebote por pared); las demás quedan intactas para `move_ball`.
+
+     El reflejo contra una pared es el mismo rebote que calcula `move_ball`: la parte del recorrido que
+     pasa la pared se refleja (x' = 2r - x para la pared izquierda) y la componente de la velocidad cambia
+     de signo.
+
+   Params:
+     pool - Bolas del juego.
+     bounds - Zonas que necesitan la detección continua.
+     dt - Duración del paso en segundos.
+     first - Primera bola del lote (múltiplo de LANES).
+     activeBits - Bits de actividad del lote.
+
+   Returns:
+     - unsigned: Un bit por cada bola que se movió.
+*/
+static unsigned step_lanes(BallPool *pool, const BallKernelBounds *bounds, float dt, int first, unsigned activeBits) {
+    vfloat radius = v_load(pool->radius + first);
+    vfloat x0 = v_load(pool->x + first);
+    vfloat y0 = v_load(pool->y + first);
+    vfloat speedX = v_load(pool->speedX + first);
+    vfloat speedY = v_load(pool->speedY + first);
+
+    vfloat right = v_sub(v_set(bounds->width), radius);
+    vfloat x1 = v_add(x0, v_mul(speedX, v_set(dt)));
+    vfloat y1 = v_add(y0, v_mul(speedY, v_set(dt)));
+
+    // Rebotes en las paredes izquierda, derecha y superior
+    vmask hitLeft = v_lt(x1, radius);
+    vmask hitRight = v_lt(right, x1);
+    vmask hitTop = v_lt(y1, radius);
+    vfloat x2 = v_select(hitLeft, v_sub(v_add(radius, radius), x1), x1);
+    x2 = v_select(hitRight, v_sub(v_add(right, right), x1), x2);
+    vfloat y2 = v_select(hitTop, v_sub(v_add(radius, radius), y1), y1);
+    vfloat speedX2 = v_negate_if(v_or(hitLeft, hitRight), speedX);
+    vfloat speedY2 = v_negate_if(hitTop, speedY);
+
+    // Empieza y termina dentro de la pantalla (si no, fue más de un rebote por pared o ya estaba afuera)
+    vmask moved = v_lanes(activeBits);
+    moved = v_and(moved, v_and(v_le(radius, x0), v_le(x0, right)));
+    moved = v_and(moved, v_and(v_le(radius, x2), v_le(x2, right)));
+    moved = v_and(moved, v_and(v_le(radius, y0), v_le(radius, y2)));
+
+    // Franja vertical que barre la bola: no toca la raqueta ni la franja de ladrillos
+    vfloat low = v_sub(v_min(y0, y1), radius);
+    vfloat high = v_add(v_max(y0, y2), radius);
+    moved = v_and(moved, v_lt(high, v_set(bounds->floor)));
+    moved = v_and(moved, v_or(v_lt(high, v_set(bounds->blockedTop)), v_lt(v_set(bounds->blockedBottom), low)));
+
+    v_store(pool->x + first, v_select(moved, x2, x0));
+    v_store(pool->y + first, v_select(moved, y2, y0));
+    v_store(pool->speedX + first, v_select(moved, speedX2, speedX));
+    v_store(pool->speedY + first, v_select(moved, speedY2, speedY));
+    return v_bits(moved);
+}
+
+/* Function: ball_kernel_step
+   Descripción:
+     Primera fase del movimiento de las bolas en `handle_collisions`. Mueve por lotes las bolas activas que
+     en este paso sólo pueden tocar paredes y marca en `pool->pending` las que podrían tocar ladrillos o la
+     raqueta, salir por abajo, o rebotar más de una vez en la misma pared; esas las mueve después
+     `move_ball` con detección continua, una por una.
+
+     Con muchas bolas (modos de estrés, jugadores automáticos) la mayoría está en la zona libre entre los
+     ladrillos y la raqueta, así que el costo del paso lo dominan unas pocas instrucciones por lote en lugar
+     de la búsqueda de contactos de cada bola. Los lotes sin bolas activas se saltan con sólo mirar sus bits.
+
+   Params:
+     pool - Bolas del juego.
+     bounds - Zonas que necesitan la detección continua.
+     dt - Duración del paso en segundos.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Los arreglos de `pool` deben tener `stride` elementos alineados a 32 bytes (ver `ball_pool_alloc`).
+
+   Example:
+     BallKernelBounds bounds = { screenWidth, top, bottom, paddleTop };
+     ball_kernel_step(&gameState->balls, &bounds, gameState->tickSeconds);
+     // Luego mover con move_ball las bolas marcadas en gameState->balls.pending
+
+   References:
+     - Intel Intrinsics Guide: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html
+*/
+void ball_kernel_step(BallPool *pool, const BallKernelBounds *bounds, float dt) {
+    memset(pool->pending, 0, (size_t)pool->words * sizeof(uint64_t));
+
+    for (int first = 0; first < pool->stride; first += LANES) {
+        int shift = first % 64;
+        unsigned activeBits = (unsigned)(pool->active[first / 64] >> shift) & LANE_BITS;
+        if (activeBits == 0) {
+            continue;
+        }
+
+        unsigned moved = step_lanes(pool, bounds, dt, first, activeBits);
+        pool->pending[first / 64] |= (uint64_t)(activeBits & ~moved) << shift;
+    }
+}
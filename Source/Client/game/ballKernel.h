@@ -0,0 +1,46 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef BALL_KERNEL_H
+#define BALL_KERNEL_H
+
+#include "../game_status.h"
+
+/*
+ * Header: Ball Kernel
+ * Mueve en lotes las bolas que durante un paso sólo pueden tocar las paredes: integra su posición y
+ * las refleja contra las paredes izquierda, derecha y superior, varias bolas por instrucción.
+ *
+ * La variante se elige al compilar: AVX2 (8 bolas por instrucción, con `-DUSE_AVX2=ON` en CMake),
+ * SSE2 (4 bolas, siempre disponible en x86-64) o escalar en otras arquitecturas. Las tres hacen las
+ * mismas operaciones en el mismo orden, así que dan resultados idénticos.
+ *
+ * Typedefs:
+ *   - BallKernelBounds: Zonas del paso en las que una bola necesita la detección continua.
+ *
+ * Functions:
+ *   - ball_pool_alloc / ball_pool_free: Memoria de las bolas, alineada para los lotes.
+ *   - ball_pool_copy: Copia todas las bolas en otro `BallPool` de la misma capacidad.
+ *   - ball_kernel_step: Mueve el lote y marca las bolas que no pudo mover.
+ */
+
+typedef struct {
+    float width;          // Ancho de la pantalla (paredes izquierda y derecha)
+    float blockedTop;     // Franja con ladrillos activos (FLT_MAX y -FLT_MAX si no queda ninguno)
+    float blockedBottom;
+    float floor;          // Borde superior de la raqueta: de aquí hacia abajo decide `move_ball`
+} BallKernelBounds;
+
+bool ball_pool_alloc(BallPool *pool, int capacity);
+void ball_pool_free(BallPool *pool);
+void ball_pool_copy(BallPool *dst, const BallPool *src);
+void ball_kernel_step(BallPool *pool, const BallKernelBounds *bounds, float dt);
+
+#endif // BALL_KERNEL_H
@@ -0,0 +1,212 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "brickBatch.h"
+#include "Objects/brick.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+#include "rlgl.h"
+
+#define BRICK_BATCH_VERTICES 6  // Dos triángulos por ladrillo, sin índices (no hay límite de 65535 vértices)
+
+// Índices de los buffers de `Mesh` en `UpdateMeshBuffer`
+#define MESH_BUFFER_POSITIONS 0
+#define MESH_BUFFER_COLORS 3
+
+static const Matrix identity = { 1, 0, 0, 0,
+                                 0, 1, 0, 0,
+                                 0, 0, 1, 0,
+                                 0, 0, 0, 1 };
+
+// Escribe los vértices y colores del ladrillo número `n` de la malla
+static void put_brick(BrickBatch *batch, int n, float left, float top, float right, float bottom, Color color) {
+    // Mismo orden que DrawRectangle, para que las caras queden hacia la cámara
+    const float corners[BRICK_BATCH_VERTICES][2] = {
+        { left, top }, { left, bottom }, { right, top },
+        { right, top }, { left, bottom }, { right, bottom }
+    };
+
+    float *vertex = batch->mesh.vertices + n * BRICK_BATCH_VERTICES * 3;
+    unsigned char *rgba = batch->mesh.colors + n * BRICK_BATCH_VERTICES * 4;
+    for (int k = 0; k < BRICK_BATCH_VERTICES; k++) {
+        vertex[k * 3 + 0] = corners[k][0];
+        vertex[k * 3 + 1] = corners[k][1];
+        vertex[k * 3 + 2] = 0.0f;
+        rgba[k * 4 + 0] = color.r;
+        rgba[k * 4 + 1] = color.g;
+        rgba[k * 4 + 2] = color.b;
+        rgba[k * 4 + 3] = color.a;
+    }
+}
+
+// Vuelve a llenar la malla con los ladrillos activos y sube sólo la parte usada
+static void rebuild(BrickBatch *batch, const GameState *gameState) {
+    const BrickGrid *grid = &gameState->bricks;
+    float width = gameState->brickSize.x - brickSpacing;
+    float height = gameState->brickSize.y - brickSpacing;
+
+    int count = 0;
+    for (int i = 0; i < grid->rows; i++) {
+        for (int word = 0; word < grid->wordsPerRow; word++) {
+            for (uint64_t bits = brick_row_bits(grid, i, word); bits != 0; bits &= bits - 1) {
+                int index = brick_index(grid, i, word * 64 + __builtin_ctzll(bits));
+
+                // Esquina en píxeles enteros, como la dibujaba DrawRectangle
+                float x = (int)(grid->position[index].x - (gameState->brickSize.x / 2) + brickSpacing / 2);
+                float y = (int)(grid->position[index].y - (gameState->brickSize.y / 2) + brickSpacing / 2);
+                put_brick(batch, count++, x, y, x + (int)width, y + (int)height, grid->color[index]);
+            }
+        }
+    }
+
+    batch->mesh.vertexCount = count * BRICK_BATCH_VERTICES;
+    batch->mesh.triangleCount = count * 2;
+    if (count > 0) {
+        UpdateMeshBuffer(batch->mesh, MESH_BUFFER_POSITIONS, batch->mesh.vertices,
+                         batch->mesh.vertexCount * 3 * (int)sizeof(float), 0);
+        UpdateMeshBuffer(batch->mesh, MESH_BUFFER_COLORS, batch->mesh.colors, batch->mesh.vertexCount * 4, 0);
+    }
+
+    memcpy(batch->active, grid->active, (size_t)batch->words * sizeof(uint64_t));
+    batch->built = true;
+}
+
+/* Function: BrickBatch_create
+   Descripción:
+     Crea la malla con capacidad para todos los ladrillos del tablero y la sube a la GPU como buffer
+     dinámico. La malla empieza vacía; se llena en el primer `BrickBatch_draw`.
+
+   Params:
+     grid - Tablero cuyas dimensiones usará la malla.
+
+   Returns:
+     - BrickBatch*: Malla lista para dibujar o `NULL` si no hay memoria.
+
+   Restriction:
+     - Desde el hilo de dibujo, después de `InitWindow`.
+
+   Example:
+     BrickBatch *batch = BrickBatch_create(&gameState->bricks);
+*/
+BrickBatch *BrickBatch_create(const BrickGrid *grid) {
+    BrickBatch *batch = calloc(1, sizeof(BrickBatch));
+    if (batch == NULL) {
+        return NULL;
+    }
+    batch->rows = grid->rows;
+    batch->cols = grid->cols;
+    batch->words = grid->rows * grid->wordsPerRow;
+    batch->capacity = grid->rows * grid->cols;
+    batch->active = calloc(batch->words > 0 ? batch->words : 1, sizeof(uint64_t));
+    if (batch->active == NULL) {
+        free(batch);
+        return NULL;
+    }
+
+    if (batch->capacity > 0) {
+        int vertices = batch->capacity * BRICK_BATCH_VERTICES;
+        batch->mesh.vertexCount = vertices;
+        batch->mesh.triangleCount = batch->capacity * 2;
+        batch->mesh.vertices = MemAlloc(vertices * 3 * (int)sizeof(float));
+        batch->mesh.texcoords = MemAlloc(vertices * 2 * (int)sizeof(float));  // Sin textura: todo en 0
+        batch->mesh.colors = MemAlloc(vertices * 4);
+        if (batch->mesh.vertices == NULL || batch->mesh.texcoords == NULL || batch->mesh.colors == NULL) {
+            MemFree(batch->mesh.vertices);
+            MemFree(batch->mesh.texcoords);
+            MemFree(batch->mesh.colors);
+            free(batch->active);
+            free(batch);
+            return NULL;
+        }
+        UploadMesh(&batch->mesh, true);
+        batch->mesh.vertexCount = 0;
+        batch->mesh.triangleCount = 0;
+    }
+    batch->material = LoadMaterialDefault();
+    return batch;
+}
+
+/* Function: BrickBatch_destroy
+   Descripción:
+     Libera la malla, sus buffers en la GPU y el material.
+
+   Params:
+     batch - Malla a liberar; puede ser NULL.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Desde el hilo de dibujo, antes de `CloseWindow`.
+*/
+void BrickBatch_destroy(BrickBatch *batch) {
+    if (batch == NULL) {
+        return;
+    }
+    if (batch->capacity > 0) {
+        UnloadMesh(batch->mesh);  // También libera los arreglos de vértices
+    }
+    UnloadMaterial(batch->material);
+    free(batch->active);
+    free(batch);
+}
+
+/* Function: BrickBatch_draw
+   Descripción:
+     Dibuja todos los ladrillos activos con una sola llamada. Si los ladrillos activos cambiaron desde el
+     cuadro anterior, primero reconstruye la malla y sube los vértices nuevos. Las posiciones y colores de
+     los ladrillos no cambian durante la partida, así que los bits activos bastan para saber si hay que
+     reconstruir.
+
+   Params:
+     batch - Malla creada para el tablero de `gameState`.
+     gameState - Estado del juego a dibujar.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Desde el hilo de dibujo, entre `BeginDrawing` y `EndDrawing`.
+
+   Example:
+     BeginDrawing();
+     BrickBatch_draw(batch, gameState);
+     EndDrawing();
+
+   Problems:
+     - Problema: Con un `DrawRectangle` por ladrillo, cada cuadro recalculaba las esquinas de todo el tablero
+       y llenaba el lote de raylib ladrillo por ladrillo.
+       - Solución: Los vértices viven en la GPU y sólo se reconstruyen cuando se destruye o reaparece un ladrillo.
+     - Problema: `DrawMesh` dibuja de inmediato, mientras que las figuras 2D esperan en el lote de rlgl.
+       - Solución: Se vacía el lote antes, para que el orden de dibujo sea el mismo que el del código.
+
+   References:
+     - raylib rmodels (UploadMesh, UpdateMeshBuffer, DrawMesh): https://www.raylib.com/cheatsheet/cheatsheet.html
+*/
+void BrickBatch_draw(BrickBatch *batch, const GameState *gameState) {
+    const BrickGrid *grid = &gameState->bricks;
+    if (batch->capacity == 0 || grid->rows != batch->rows || grid->cols != batch->cols) {
+        return;
+    }
+
+    if (!batch->built || memcmp(batch->active, grid->active, (size_t)batch->words * sizeof(uint64_t)) != 0) {
+        rebuild(batch, gameState);
+    }
+    if (batch->mesh.vertexCount == 0) {
+        return;
+    }
+
+    rlDrawRenderBatchActive();
+    DrawMesh(batch->mesh, batch->material, identity);
+}
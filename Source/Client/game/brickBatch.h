@@ -0,0 +1,47 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef BRICK_BATCH_H
+#define BRICK_BATCH_H
+
+#include <stdint.h>
+#include "raylib.h"
+
+#include "../game_status.h"
+
+/*
+ * Header: Brick Batch
+ * Malla con los ladrillos activos del tablero (dos triángulos por ladrillo, con el color en cada vértice)
+ * que se dibuja con una sola llamada a `DrawMesh`.
+ *
+ *   - Los vértices quedan en la GPU y sólo se vuelven a subir cuando cambia el conjunto de ladrillos
+ *     activos; en un cuadro sin cambios no se recalcula ninguna esquina.
+ *   - Usa recursos de OpenGL: se crea, dibuja y destruye en el hilo de dibujo, con la ventana abierta.
+ */
+
+typedef struct {
+    Mesh mesh;           // Capacidad para todos los ladrillos; `vertexCount` dice cuántos se dibujan
+    Material material;   // Material por defecto: el color viene de los vértices
+    int rows;
+    int cols;
+    int words;           // Palabras de `active` (rows * wordsPerRow del tablero)
+    int capacity;        // Ladrillos que caben en la malla (rows * cols)
+    uint64_t *active;    // Bits activos con los que se construyó la malla
+    bool built;
+} BrickBatch;
+
+// Constructor y Destructor
+BrickBatch *BrickBatch_create(const BrickGrid *grid);
+void BrickBatch_destroy(BrickBatch *batch);
+
+// Métodos de la clase
+void BrickBatch_draw(BrickBatch *batch, const GameState *gameState);
+
+#endif // BRICK_BATCH_H
@@ -13,210 +13,329 @@ Consulta el archivo LICENSE para más detalles.
 //BIBLIOTECAS EXTRERNAS
 #include <raylib.h>
 #include <math.h>
+#include <float.h>
 // BIBLIOTECAS DE PROYECTO
 #include "collision_handler.h"
 #include "powerHandler.h"
+#include "Objects/ball.h"
+#include "Objects/brick.h"
+#include "ballKernel.h"
+
+#define MAX_HITS_PER_TICK 8  // Rebotes resueltos por bola en un paso; el resto del movimiento se descarta
+
+// Qué tocó la bola primero durante su recorrido
+typedef enum {
+    CONTACT_NONE,
+    CONTACT_WALL,
+    CONTACT_PADDLE,
+    CONTACT_BRICK
+} ContactType;
+
+typedef struct {
+    ContactType type;
+    float time;       // Fracción del recorrido en [0, 1] en la que ocurre el contacto
+    Vector2 normal;   // Normal de la superficie, apuntando hacia la bola
+    int row;          // Ladrillo tocado (sólo CONTACT_BRICK)
+    int column;
+} Contact;
+
+// Igual que `CheckCollisionCircleRec` de raylib, pero sin depender de la biblioteca para que la
+// simulación también compile sin ventana (ver `headless.c`).
+static bool circle_intersects_rect(Vector2 center, float radius, Rectangle rect) {
+    float closestX = fmaxf(rect.x, fminf(center.x, rect.x + rect.width));
+    float closestY = fmaxf(rect.y, fminf(center.y, rect.y + rect.height));
+    float dx = center.x - closestX;
+    float dy = center.y - closestY;
+    return dx * dx + dy * dy <= radius * radius;
+}
+
+static Rectangle paddle_rect(const Player *player) {
+    return (Rectangle) {player->position.x - player->size.x / 2, player->position.y - player->size.y / 2,
+                        player->size.x, player->size.y};
+}
+
+// Esquina superior izquierda de la grilla de ladrillos (ver `init_bricks`)
+static Vector2 grid_origin(const GameState *gameState) {
+    Vector2 first = brick_position(&gameState->bricks, 0, 0);
+    return (Vector2) {first.x - gameState->brickSize.x / 2, first.y - gameState->brickSize.y / 2};
+}
+
+static Rectangle brick_rect(const GameState *gameState, int i, int j) {
+    Vector2 center = brick_position(&gameState->bricks, i, j);
+    return (Rectangle) {center.x - gameState->brickSize.x / 2, center.y - gameState->brickSize.y / 2,
+                        gameState->brickSize.x, gameState->brickSize.y};
+}
+
+// Rango de celdas [first, last] de una fila o columna de la grilla que cubre el intervalo [low, high].
+// Devuelve false si el intervalo queda completamente fuera de la grilla.
+static bool cell_range(float low, float high, float origin, float cellSize, int count, int *first, int *last) {
+    int from = (int)floorf((low - origin) / cellSize);
+    int to = (int)floorf((high - origin) / cellSize);
+    if (to < 0 || from >= count) return false;
+    *first = from < 0 ? 0 : from;
+    *last = to >= count ? count - 1 : to;
+    return true;
+}
 
-/* Function: handle_ball_wall_collision
+// Se queda con el contacto más temprano
+static void keep_earliest(Contact *best, ContactType type, float time, Vector2 normal, int row, int column) {
+    if (time < best->time || best->type == CONTACT_NONE) {
+        *best = (Contact) {type, time, normal, row, column};
+    }
+}
+
+/* Function: sweep_circle_rect
 Descripción:
-Gestiona las colisiones de las bolas activas con las paredes de la pantalla. Invierte la dirección de
-la velocidad de la bola cuando colisiona con los bordes horizontales o el borde superior. Detiene y
-desactiva la bola si colisiona con el borde inferior.
+Calcula el instante de impacto de un círculo que se mueve en línea recta contra un rectángulo. Es un rayo
+contra el rectángulo agrandado `radius` por cada lado (suma de Minkowski); si el rayo entra por una de las
+esquinas, la esquina es un cuarto de círculo y se resuelve como rayo contra círculo.
 
 Params:
-gameState - Puntero al estado global del juego que contiene las bolas y su información.
-screenWidth - Ancho de la pantalla.
-screenHeight - Alto de la pantalla.
+start - Centro del círculo al inicio del recorrido.
+move - Desplazamiento del centro durante el recorrido.
+radius - Radio del círculo.
+rect - Rectángulo a probar.
+time - Recibe la fracción del recorrido en [0, 1] en la que ocurre el contacto.
+normal - Recibe la normal de la superficie tocada.
 
 Returns:
-- void: No retorna valores.
+- bool: `true` si el círculo toca el rectángulo durante el recorrido acercándose a él.
 
 Restriction:
-- `gameState` debe estar correctamente inicializado con información válida sobre las bolas.
-- `screenWidth` y `screenHeight` deben reflejar las dimensiones actuales de la pantalla.
-
-Example:
-handle_ball_wall_collision(&gameState, 800, 600);
-// Maneja las colisiones de las bolas con las paredes en una pantalla de 800x600.
-
-Problems:
-- Problema: Si `screenWidth` o `screenHeight` no corresponden a las dimensiones reales de la pantalla,
-las colisiones podrían comportarse de manera incorrecta.
-- Solución: Validar las dimensiones antes de llamar a la función.
+- Si el círculo ya se solapa con el rectángulo al inicio no se reporta contacto; así una bola que acaba
+de rebotar no vuelve a chocar con la misma superficie.
 
 References:
-- Ninguna referencia externa específica.
+- Ericson, C. (2004). Real-Time Collision Detection, cap. 5.5.7 (Intersecting Moving Sphere Against AABB). Morgan Kaufmann.
 */
-void handle_ball_wall_collision(GameState *gameState, float screenWidth, float screenHeight) {
-
-    for (int i = 0; i < gameState->maxBalls; i++) {
-        Ball *ball = &gameState->balls[i]; // Access the ball directly from gameState
-        if (ball->active) {
-            // Check for wall collisions
-            if ((ball->position.x + ball->radius) >= screenWidth || (ball->position.x - ball->radius) <= 0) {
-                ball->speed.x *= -1; // Reverse horizontal speed
-            }
-            if ((ball->position.y - ball->radius) <= 0) {
-                ball->speed.y *= -1; // Reverse vertical speed
-            }
-            if ((ball->position.y + ball->radius) >= screenHeight) {
-                ball->speed = (Vector2) {0, 0}; // Stop the ball
-                ball->active = false; // Deactivate the ball
-            }
-
+static bool sweep_circle_rect(Vector2 start, Vector2 move, float radius, Rectangle rect, float *time, Vector2 *normal) {
+    float low[2] = { rect.x - radius, rect.y - radius };
+    float high[2] = { rect.x + rect.width + radius, rect.y + rect.height + radius };
+    float origin[2] = { start.x, start.y };
+    float delta[2] = { move.x, move.y };
+
+    float enter = -INFINITY;
+    float exit = INFINITY;
+    int axis = -1;
+    for (int k = 0; k < 2; k++) {
+        if (delta[k] == 0.0f) {
+            if (origin[k] <= low[k] || origin[k] >= high[k]) return false;
+            continue;
         }
-
+        float t1 = (low[k] - origin[k]) / delta[k];
+        float t2 = (high[k] - origin[k]) / delta[k];
+        if (t1 > t2) { float swap = t1; t1 = t2; t2 = swap; }
+        if (t1 > enter) { enter = t1; axis = k; }
+        if (t2 < exit) exit = t2;
+    }
+    if (axis < 0 || enter > exit || exit < 0.0f || enter > 1.0f) return false;
+
+    // Punto de entrada al rectángulo agrandado: ¿cara o esquina? Si el recorrido empieza dentro del
+    // rectángulo agrandado sólo puede haber contacto por una esquina (fuera del cuarto de círculo).
+    float from = fmaxf(enter, 0.0f);
+    Vector2 hit = { start.x + move.x * from, start.y + move.y * from };
+    float cornerX = hit.x < rect.x ? rect.x : (hit.x > rect.x + rect.width ? rect.x + rect.width : NAN);
+    float cornerY = hit.y < rect.y ? rect.y : (hit.y > rect.y + rect.height ? rect.y + rect.height : NAN);
+
+    if (isnan(cornerX) || isnan(cornerY)) {
+        if (enter < 0.0f) return false;  // Ya se solapa con una cara
+        *time = enter;
+        *normal = axis == 0 ? (Vector2) {move.x > 0 ? -1.0f : 1.0f, 0} : (Vector2) {0, move.y > 0 ? -1.0f : 1.0f};
+        return true;
     }
 
-}
-
-
-/* Function: handle_ball_player_collision
-Descripción:
-Gestiona la colisión entre las bolas activas y el jugador (raqueta). Si una bola colisiona con la raqueta,
-invierte su dirección vertical y ajusta su velocidad horizontal en función de la posición relativa del impacto.
-
-Params:
-gameStatus - Puntero al estado global del juego que contiene la información de las bolas y el jugador.
+    // Esquina redondeada: rayo contra el círculo de radio `radius` centrado en la esquina
+    Vector2 relative = { start.x - cornerX, start.y - cornerY };
+    float a = move.x * move.x + move.y * move.y;
+    float b = 2.0f * (relative.x * move.x + relative.y * move.y);
+    float c = relative.x * relative.x + relative.y * relative.y - radius * radius;
+    float discriminant = b * b - 4.0f * a * c;
+    if (c <= 0.0f || discriminant < 0.0f) return false;
 
-Returns:
-- void: No retorna valores.
+    float t = (-b - sqrtf(discriminant)) / (2.0f * a);
+    if (t < 0.0f || t > 1.0f) return false;
 
-Restriction:
-- `gameStatus` debe estar correctamente inicializado con las posiciones y tamaños del jugador y las bolas.
+    *time = t;
+    *normal = (Vector2) {(relative.x + move.x * t) / radius, (relative.y + move.y * t) / radius};
+    return true;
+}
 
-Example:
-handle_ball_player_collision(&gameStatus);
-// Maneja las colisiones entre las bolas activas y la raqueta del jugador.
+// Paredes izquierda, derecha y superior. Si la bola ya está más allá de la pared el contacto es inmediato.
+static void find_wall_contact(const Ball *ball, Vector2 move, Contact *best) {
+    float radius = (float)ball->radius;
+    if (move.x < 0 && ball->position.x + move.x < radius) {
+        keep_earliest(best, CONTACT_WALL, fmaxf(0.0f, (radius - ball->position.x) / move.x), (Vector2) {1, 0}, 0, 0);
+    }
+    if (move.x > 0 && ball->position.x + move.x > screenWidth - radius) {
+        keep_earliest(best, CONTACT_WALL, fmaxf(0.0f, (screenWidth - radius - ball->position.x) / move.x), (Vector2) {-1, 0}, 0, 0);
+    }
+    if (move.y < 0 && ball->position.y + move.y < radius) {
+        keep_earliest(best, CONTACT_WALL, fmaxf(0.0f, (radius - ball->position.y) / move.y), (Vector2) {0, 1}, 0, 0);
+    }
+}
 
-Problems:
-- Problema: Si las posiciones o dimensiones de los objetos no están correctamente configuradas,
-la detección de colisión puede fallar o generar resultados incorrectos.
-- Solución: Validar las propiedades del jugador y las bolas antes de llamar a esta función.
+// La raqueta sólo detiene bolas que bajan
+static void find_paddle_contact(const GameState *gameState, const Ball *ball, Vector2 move, Contact *best) {
+    float time;
+    Vector2 normal;
+    if (move.y > 0 && sweep_circle_rect(ball->position, move, ball->radius, paddle_rect(&gameState->player), &time, &normal)) {
+        keep_earliest(best, CONTACT_PADDLE, time, normal, 0, 0);
+    }
+}
 
-References:
-- CheckCollisionCircleRec: https://www.raylib.com
-*/
+// Los ladrillos están en una grilla regular (ver `init_bricks`): sólo se prueban las celdas que cubre
+// el recorrido de la bola, así el costo no depende del tamaño del tablero.
+static void find_brick_contact(const GameState *gameState, const Ball *ball, Vector2 move, Contact *best) {
+    Vector2 cell = gameState->brickSize;
+    Vector2 origin = grid_origin(gameState);
+    Vector2 end = { ball->position.x + move.x, ball->position.y + move.y };
+
+    int firstRow, lastRow, firstColumn, lastColumn;
+    if (!cell_range(fminf(ball->position.y, end.y) - ball->radius, fmaxf(ball->position.y, end.y) + ball->radius,
+                    origin.y, cell.y, gameState->linesOfBricks, &firstRow, &lastRow) ||
+        !cell_range(fminf(ball->position.x, end.x) - ball->radius, fmaxf(ball->position.x, end.x) + ball->radius,
+                    origin.x, cell.x, gameState->bricksPerLine, &firstColumn, &lastColumn)) {
+        return;  // El recorrido no pasa por el tablero
+    }
 
-void handle_ball_player_collision(GameState *gameStatus) {
-    for (int i = 0; i < gameStatus->maxBalls; i++) {
-        // Lógica de Colisión: bola vs jugador
-        if (CheckCollisionCircleRec(gameStatus->balls[i].position, gameStatus->balls[i].radius,
-                                    (Rectangle) {gameStatus->player.position.x - gameStatus->player.size.x / 2,
-                                                 gameStatus->player.position.y - gameStatus->player.size.y / 2,
-                                                 gameStatus->player.size.x, gameStatus->player.size.y})) {
-            if (gameStatus->balls[i].speed.y > 0) {
-                gameStatus->balls[i].speed.y *= -1;
-                gameStatus->balls[i].speed.x = (gameStatus->balls[i].position.x - gameStatus->player.position.x) /
-                                              (gameStatus->player.size.x / 2) * 5;
+    for (int i = firstRow; i <= lastRow; i++) {
+        for (int j = firstColumn; j <= lastColumn; j++) {
+            float time;
+            Vector2 normal;
+            if (brick_is_active(&gameState->bricks, i, j) &&
+                sweep_circle_rect(ball->position, move, ball->radius, brick_rect(gameState, i, j), &time, &normal)) {
+                keep_earliest(best, CONTACT_BRICK, time, normal, i, j);
             }
-                                                 }
+        }
     }
 }
 
-/* Function: handle_ball_brick_collision
+// Rebote en la raqueta: sube y sale con un ángulo según dónde golpeó
+static void deflect_from_paddle(const Player *player, Ball *ball) {
+    ball->speed.y = -fabsf(ball->speed.y);
+    ball->speed.x = (ball->position.x - player->position.x) / (player->size.x / 2) * BALL_SPEED;
+}
+
+static void reflect(Ball *ball, Vector2 normal) {
+    float along = ball->speed.x * normal.x + ball->speed.y * normal.y;
+    ball->speed.x -= 2.0f * along * normal.x;
+    ball->speed.y -= 2.0f * along * normal.y;
+}
+
+/* Function: move_ball
 Descripción:
-Gestiona las colisiones entre las bolas activas y los ladrillos. Al detectar una colisión,
-desactiva el ladrillo, invierte la dirección de la velocidad de la bola, y actualiza la puntuación
-del jugador.
+Avanza una bola activa durante un paso con detección continua de colisiones. Busca el primer contacto
+de su recorrido (paredes, raqueta o ladrillos), la lleva hasta ese punto, rebota y continúa con el tiempo
+que le queda, hasta `MAX_HITS_PER_TICK` contactos por paso. Así una bola rápida no atraviesa ladrillos ni
+la raqueta aunque avance más que su tamaño en un paso, y varios golpes en el mismo paso se resuelven en
+el orden en que ocurren.
 
 Params:
-gameState - Puntero al estado global del juego (`GameState *`) que contiene la información de las bolas,
-ladrillos y su estado actual.
+gameState - Puntero al estado global del juego.
+index - Índice de la bola en `gameState->balls`.
+dt - Duración del paso en segundos.
 
 Returns:
 - void: No retorna valores.
 
-Restriction:
-- `gameState` debe estar correctamente inicializado con posiciones, tamaños y estados válidos
-de los ladrillos y bolas.
-
-Example:
-handle_ball_brick_collision(&gameState);
-// Gestiona las colisiones de las bolas con los ladrillos activos.
-
 Problems:
-- Problema: Si `gameState` no está completamente inicializado, las detecciones de colisión
-podrían fallar o generar resultados inconsistentes.
-- Solución: Validar previamente el estado del juego.
-- Problema: Puede haber redundancia en los bloques de código de colisión (e.g., para arriba, abajo, izquierda, derecha).
-- Solución: Simplificar la lógica de colisión utilizando funciones auxiliares reutilizables.
+- Problema: Con la prueba anterior (posición contra `posición + velocidad` al final del paso) una bola
+acelerada por `speedUp` atravesaba ladrillos y la raqueta.
+- Solución: Instante de impacto de un círculo en movimiento contra cada rectángulo (`sweep_circle_rect`).
+- Problema: Una bola atrapada entre superficies podría rebotar sin fin dentro de un paso.
+- Solución: Se limita a `MAX_HITS_PER_TICK` contactos; el resto del movimiento del paso se descarta.
 
 References:
-- Ninguna referencia externa específica.
+- Ericson, C. (2004). Real-Time Collision Detection, cap. 5.5 y 7.1 (Uniform Grids). Morgan Kaufmann.
 */
+static void move_ball(GameState *gameState, int index, float dt) {
+    Ball current = ball_load(&gameState->balls, index);
+    Ball *ball = &current;
+    float remaining = dt;
+
+    // La raqueta se movió encima de la bola: mismo rebote que si la bola la hubiera alcanzado
+    if (ball->speed.y > 0 && circle_intersects_rect(ball->position, ball->radius, paddle_rect(&gameState->player))) {
+        deflect_from_paddle(&gameState->player, ball);
+    }
+
+    for (int hits = 0; ball->active && remaining > 0 && hits < MAX_HITS_PER_TICK; hits++) {
+        Vector2 move = { ball->speed.x * remaining, ball->speed.y * remaining };
+        Contact contact = { CONTACT_NONE, 1.0f, { 0, 0 }, 0, 0 };
+
+        find_wall_contact(ball, move, &contact);
+        find_paddle_contact(gameState, ball, move, &contact);
+        find_brick_contact(gameState, ball, move, &contact);
+
+        ball->position.x += move.x * contact.time;
+        ball->position.y += move.y * contact.time;
+        remaining -= remaining * contact.time;
+
+        switch (contact.type) {
+            case CONTACT_NONE:
+                remaining = 0;
+                break;
+            case CONTACT_WALL:
+                reflect(ball, contact.normal);
+                break;
+            case CONTACT_PADDLE:
+                deflect_from_paddle(&gameState->player, ball);
+                break;
+            case CONTACT_BRICK:
+                reflect(ball, contact.normal);
+                deactivate_brick(&gameState->bricks, contact.row, contact.column);
+                StateJournal_record(gameState->journal, JOURNAL_BRICK_DESTROYED, contact.row, contact.column);
+                update_player_score(contact.row, contact.column);
+                // El poder puede cambiar la velocidad de todas las bolas (SPEED_UP), incluida ésta
+                ball_store(&gameState->balls, index, ball);
+                check_brick(contact.row, contact.column);
+                current = ball_load(&gameState->balls, index);
+                break;
+        }
+    }
+
+    // Borde inferior: la bola se pierde
+    if (ball->active && ball->position.y + ball->radius >= screenHeight) {
+        ball->speed = (Vector2) {0, 0};
+        ball->active = false;
+        StateJournal_record(gameState->journal, JOURNAL_BALL_DESPAWN, index, 0);
+    }
+    ball_store(&gameState->balls, index, ball);
+}
 
-void handle_ball_brick_collision(GameState *gameState) {
-    // Collision logic: ball vs bricks
-    for (int i = 0; i < gameState->linesOfBricks; i++) {
-        for (int j = 0; j < gameState->bricksPerLine; j++) {
-            if (gameState->bricks[i][j].active) {
-                for (int b = 0; b < gameState->maxBalls; b++) {
-                    Ball *ball = &gameState->balls[b];
-
-                    if (ball->active) {
-                        // Hit below
-                        if (((ball->position.y - ball->radius) <=
-                             (gameState->bricks[i][j].position.y + gameState->brickSize.y / 2)) &&
-                            ((ball->position.y - ball->radius) >
-                             (gameState->bricks[i][j].position.y + gameState->brickSize.y / 2 + ball->speed.y)) &&
-                            ((fabs(ball->position.x - gameState->bricks[i][j].position.x)) <
-                             (gameState->brickSize.x / 2 + ball->radius * 2 / 3)) && (ball->speed.y < 0)) {
-                            gameState->bricks[i][j].active = false;
-                            ball->speed.y *= -1;
-
-                            update_player_score(i, j);
-                            check_brick(i, j);
-                        }
-                        // Hit above
-                        else if (((ball->position.y + ball->radius) >=
-                                  (gameState->bricks[i][j].position.y - gameState->brickSize.y / 2)) &&
-                                 ((ball->position.y + ball->radius) <
-                                  (gameState->bricks[i][j].position.y - gameState->brickSize.y / 2 + ball->speed.y)) &&
-                                 ((fabs(ball->position.x - gameState->bricks[i][j].position.x)) <
-                                  (gameState->brickSize.x / 2 + ball->radius * 2 / 3)) && (ball->speed.y > 0)) {
-                            gameState->bricks[i][j].active = false;
-                            ball->speed.y *= -1;
-
-                            update_player_score(i, j);
-                            check_brick(i, j);
-                        }
-                        // Hit left
-                        else if (((ball->position.x + ball->radius) >=
-                                  (gameState->bricks[i][j].position.x - gameState->brickSize.x / 2)) &&
-                                 ((ball->position.x + ball->radius) <
-                                  (gameState->bricks[i][j].position.x - gameState->brickSize.x / 2 + ball->speed.x)) &&
-                                 ((fabs(ball->position.y - gameState->bricks[i][j].position.y)) <
-                                  (gameState->brickSize.y / 2 + ball->radius * 2 / 3)) && (ball->speed.x > 0)) {
-                            gameState->bricks[i][j].active = false;
-                            ball->speed.x *= -1;
-
-                            update_player_score(i, j);
-                            check_brick(i, j);
-                        }
-                        // Hit right
-                        else if (((ball->position.x - ball->radius) <=
-                                  (gameState->bricks[i][j].position.x + gameState->brickSize.x / 2)) &&
-                                 ((ball->position.x - ball->radius) >
-                                  (gameState->bricks[i][j].position.x + gameState->brickSize.x / 2 + ball->speed.x)) &&
-                                 ((fabs(ball->position.y - gameState->bricks[i][j].position.y)) <
-                                  (gameState->brickSize.y / 2 + ball->radius * 2 / 3)) && (ball->speed.x < 0)) {
-                            gameState->bricks[i][j].active = false;
-                            ball->speed.x *= -1;
-
-                            update_player_score(i, j);
-                            check_brick(i, j);
-                        }
-                    }
-                }
+// Zonas en las que una bola necesita `move_ball`: la franja de filas con ladrillos activos y, desde el
+// borde superior de la raqueta, todo lo de abajo (raqueta y borde inferior).
+static BallKernelBounds kernel_bounds(const GameState *gameState) {
+    BallKernelBounds bounds = {
+        .width = screenWidth,
+        .blockedTop = FLT_MAX,
+        .blockedBottom = -FLT_MAX,
+        .floor = gameState->player.position.y - gameState->player.size.y / 2
+    };
+
+    const BrickGrid *grid = &gameState->bricks;
+    int firstRow = -1, lastRow = -1;
+    for (int i = 0; i < grid->rows; i++) {
+        for (int word = 0; word < grid->wordsPerRow; word++) {
+            if (brick_row_bits(grid, i, word) != 0) {
+                if (firstRow < 0) firstRow = i;
+                lastRow = i;
+                break;
             }
         }
     }
+    if (firstRow >= 0) {
+        Vector2 origin = grid_origin(gameState);
+        bounds.blockedTop = origin.y + firstRow * gameState->brickSize.y;
+        bounds.blockedBottom = origin.y + (lastRow + 1) * gameState->brickSize.y;
+    }
+    return bounds;
 }
+
 /* Function: handle_collisions
    Descripción:
-     Gestiona todas las colisiones en el juego, incluyendo las colisiones de las bolas con las paredes,
-     el jugador y los ladrillos.
+     Mueve las bolas activas durante el paso y resuelve sus colisiones con las paredes, el jugador y los
+     ladrillos. Primero `ball_kernel_step` mueve por lotes las bolas que sólo pueden tocar paredes; las que
+     quedan marcadas en `balls.pending` las mueve `move_ball` una por una, con detección continua.
 
    Params:
      gameState - Puntero al estado global del juego (`GameState *`) que contiene la información necesaria
@@ -227,8 +346,7 @@ void handle_ball_brick_collision(GameState *gameState) {
 
    Restriction:
      - `gameState` debe estar correctamente inicializado antes de llamar a esta función.
-     - Las funciones auxiliares como `handle_ball_wall_collision`, `handle_ball_player_collision`, y
-       `handle_ball_brick_collision` deben estar correctamente implementadas.
+     - Las bolas activas sólo se mueven aquí; `update_ball_positions` se encarga de las inactivas.
 
    Example:
      handle_collisions(&gameState);
@@ -240,14 +358,21 @@ void handle_ball_brick_collision(GameState *gameState) {
        - Solución: Asegurar pruebas independientes de cada función auxiliar.
 */
 void handle_collisions(GameState *gameState) {
-    handle_ball_wall_collision(gameState, screenWidth, screenHeight);
-    handle_ball_player_collision(gameState);
-    handle_ball_brick_collision(gameState);
+    BallPool *balls = &gameState->balls;
+    BallKernelBounds bounds = kernel_bounds(gameState);
+    ball_kernel_step(balls, &bounds, gameState->tickSeconds);
+
+    for (int word = 0; word < balls->words; word++) {
+        for (uint64_t bits = balls->pending[word]; bits != 0; bits &= bits - 1) {
+            move_ball(gameState, word * 64 + __builtin_ctzll(bits), gameState->tickSeconds);
+        }
+    }
 }
 
 /* Function: bloquesEliminados
 Descripción:
-Verifica si todos los ladrillos del juego han sido eliminados, es decir, están inactivos.
+Verifica si todos los ladrillos del juego han sido eliminados, es decir, están inactivos. Cuenta los bits de
+actividad del tablero en lugar de revisar ladrillo por ladrillo.
 
 Params:
 gameState - Puntero al estado global del juego (`GameState *`) que contiene la información de los ladrillos.
@@ -269,13 +394,6 @@ el resultado puede ser incorrecto.
 - Solución: Garantizar que los estados de los ladrillos se actualicen correctamente.
 */
 bool bloquesEliminados(GameState* gameState) {
-    for (int i = 0; i < gameState->linesOfBricks; i++) {
-        for (int j = 0; j < gameState->bricksPerLine; j++) {
-            if (gameState->bricks[i][j].active) {
-                return false; // Hay al menos un ladrillo activo
-            }
-        }
-    }
-    return true; // Todos los ladrillos están inactivos
+    return bricks_active_count(&gameState->bricks) == 0;
 }
 
@@ -0,0 +1,194 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "commandQueue.h"
+#include "ballKernel.h"
+#include "Objects/brick.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+
+
+// Estado recibido de una casilla: sólo las dimensiones y los arreglos que llenan los espectadores
+GameState *received_state_create(const GameState *gameState) {
+    GameState *state = calloc(1, sizeof(GameState));
+    if (state == NULL) {
+        return NULL;
+    }
+    state->maxBalls = gameState->maxBalls;
+    state->linesOfBricks = gameState->linesOfBricks;
+    state->bricksPerLine = gameState->bricksPerLine;
+    if (!ball_pool_alloc(&state->balls, gameState->balls.capacity)
+        || !brick_grid_alloc(&state->bricks, gameState->bricks.rows, gameState->bricks.cols)) {
+        ball_pool_free(&state->balls);
+        free(state);
+        return NULL;
+    }
+    return state;
+}
+
+void received_state_destroy(GameState *state) {
+    if (state == NULL) {
+        return;
+    }
+    ball_pool_free(&state->balls);
+    brick_grid_free(&state->bricks);
+    free(state);
+}
+
+/* Function: CommandQueue_create
+   Descripción:
+     Crea la cola vacía y reserva en cada casilla un estado con las dimensiones de `gameState`, para que
+     el productor pueda escribir ahí el estado que reciben los espectadores.
+
+   Params:
+     gameState - Estado del juego ya inicializado (dimensiones del tablero y cantidad de bolas).
+
+   Returns:
+     - CommandQueue*: Cola lista para usar o `NULL` si no hay memoria.
+
+   Example:
+     gameState->commands = CommandQueue_create(gameState);
+*/
+CommandQueue *CommandQueue_create(const GameState *gameState) {
+    CommandQueue *queue = aligned_alloc(COMMAND_QUEUE_CACHE_LINE, sizeof(CommandQueue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    memset(queue, 0, sizeof(CommandQueue));
+
+    for (int k = 0; k < COMMAND_QUEUE_CAPACITY; k++) {
+        queue->slots[k].state = received_state_create(gameState);
+        if (queue->slots[k].state == NULL) {
+            CommandQueue_destroy(queue);
+            return NULL;
+        }
+    }
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    return queue;
+}
+
+/* Function: CommandQueue_destroy
+   Descripción:
+     Libera la cola y los estados de sus casillas. Los comandos pendientes se descartan.
+
+   Params:
+     queue - Cola a liberar; puede ser NULL.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Ni el productor ni el consumidor pueden estar usándola.
+*/
+void CommandQueue_destroy(CommandQueue *queue) {
+    if (queue == NULL) {
+        return;
+    }
+    for (int k = 0; k < COMMAND_QUEUE_CAPACITY; k++) {
+        received_state_destroy(queue->slots[k].state);
+    }
+    free(queue);
+}
+
+/* Function: CommandQueue_reserve
+   Descripción:
+     Devuelve la siguiente casilla libre para que el productor escriba el comando en ella. El consumidor no
+     la ve hasta `CommandQueue_commit`; si el productor no llama a `commit`, la misma casilla se vuelve a
+     entregar en la siguiente reserva.
+
+   Params:
+     queue - Cola de comandos.
+
+   Returns:
+     - GameCommand*: Casilla a llenar, o `NULL` si la cola está llena.
+
+   Restriction:
+     - Sólo desde el hilo productor (el reactor de red).
+
+   Example:
+     GameCommand *command = CommandQueue_reserve(gameState->commands);
+     if (command != NULL) {
+         command->type = GAME_COMMAND_BRICK_POWER;
+         ...
+         CommandQueue_commit(gameState->commands);
+     }
+*/
+GameCommand *CommandQueue_reserve(CommandQueue *queue) {
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    if (tail - head >= COMMAND_QUEUE_CAPACITY) {
+        return NULL;
+    }
+    return &queue->slots[tail & (COMMAND_QUEUE_CAPACITY - 1)];
+}
+
+/* Function: CommandQueue_commit
+   Descripción:
+     Publica la casilla devuelta por la última `CommandQueue_reserve`.
+
+   Params:
+     queue - Cola de comandos.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Sólo desde el hilo productor, después de una reserva que no devolvió `NULL`.
+*/
+void CommandQueue_commit(CommandQueue *queue) {
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+}
+
+/* Function: CommandQueue_peek
+   Descripción:
+     Devuelve el comando más antiguo sin sacarlo de la cola. El productor no vuelve a escribir esa casilla
+     hasta `CommandQueue_release`, así que el consumidor puede leerla sin copiarla.
+
+   Params:
+     queue - Cola de comandos.
+
+   Returns:
+     - const GameCommand*: Comando más antiguo, o `NULL` si la cola está vacía.
+
+   Restriction:
+     - Sólo desde el hilo consumidor (la simulación).
+*/
+const GameCommand *CommandQueue_peek(CommandQueue *queue) {
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    if (head == tail) {
+        return NULL;
+    }
+    return &queue->slots[head & (COMMAND_QUEUE_CAPACITY - 1)];
+}
+
+/* Function: CommandQueue_release
+   Descripción:
+     Saca de la cola el comando devuelto por `CommandQueue_peek` y devuelve su casilla al productor.
+
+   Params:
+     queue - Cola de comandos.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Sólo desde el hilo consumidor, después de un `peek` que no devolvió `NULL`.
+*/
+void CommandQueue_release(CommandQueue *queue) {
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+}
@@ -0,0 +1,71 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../game_status.h"
+
+/*
+ * Header: Command Queue
+ * Cola circular sin locks de un productor y un consumidor para los comandos que llegan por la red.
+ *
+ *   - El hilo del reactor (productor) interpreta cada mensaje fuera de la simulación y escribe el
+ *     resultado directamente en la casilla que le da `CommandQueue_reserve`.
+ *   - La simulación (consumidor) vacía la cola al inicio de cada paso (`apply_game_commands`) y es la
+ *     única que modifica el `GameState` con esos comandos.
+ *
+ * Las casillas se reservan al crear la cola, incluido el estado recibido de los espectadores, así que
+ * encolar no pide memoria. Si la cola está llena el comando se descarta.
+ */
+
+#define COMMAND_QUEUE_CAPACITY 64  // Potencia de dos
+#define COMMAND_QUEUE_CACHE_LINE 64
+
+typedef enum {
+    GAME_COMMAND_BRICK_POWER,     // Poder (o puntos) para un ladrillo: row, column, power
+    GAME_COMMAND_SPECTATOR_STATE  // Estado completo del jugador observado: state
+} GameCommandType;
+
+typedef struct {
+    GameCommandType type;
+    int row;
+    int column;
+    PowerType power;
+    GameState *state;  // Estado recibido; propio de la casilla (ladrillos y bolas incluidos)
+    long long receivedAt;  // Llegada del estado recibido (CLOCK_MONOTONIC, ns)
+} GameCommand;
+
+typedef struct CommandQueue {
+    // Índices que crecen sin límite; la casilla es índice % COMMAND_QUEUE_CAPACITY
+    _Alignas(COMMAND_QUEUE_CACHE_LINE) atomic_size_t head;  // Siguiente casilla a leer (consumidor)
+    _Alignas(COMMAND_QUEUE_CACHE_LINE) atomic_size_t tail;  // Siguiente casilla a escribir (productor)
+    _Alignas(COMMAND_QUEUE_CACHE_LINE) GameCommand slots[COMMAND_QUEUE_CAPACITY];
+} CommandQueue;
+
+// Constructor y Destructor
+CommandQueue *CommandQueue_create(const GameState *gameState);
+void CommandQueue_destroy(CommandQueue *queue);
+
+// Estado con las dimensiones de `gameState` para guardar lo que reciben los espectadores
+GameState *received_state_create(const GameState *gameState);
+void received_state_destroy(GameState *state);
+
+// Métodos de la clase
+GameCommand *CommandQueue_reserve(CommandQueue *queue);
+void CommandQueue_commit(CommandQueue *queue);
+const GameCommand *CommandQueue_peek(CommandQueue *queue);
+void CommandQueue_release(CommandQueue *queue);
+
+#endif // COMMAND_QUEUE_H
@@ -21,19 +21,30 @@ Consulta el archivo LICENSE para más detalles.
 #include "game_logic.h"
 #include "Objects/player.h"
 #include "Objects/ball.h"
+#include "Objects/brick.h"
 #include "../comunicaciones/comServer.h"
+#include "../comunicaciones/stateCodec.h"
+#include "../comunicaciones/jsonWriter.h"
+#include "stateJson.h"
+#include "../configuracion/configuracion.h"
 #include "collision_handler.h"
 #include "powerHandler.h"
+#include "snapshotBuffer.h"
+#include "commandQueue.h"
+#include "replayLog.h"
+#include "jitterBuffer.h"
 
 
 /* Function: update_game
    Descripción:
      Actualiza el estado del juego durante cada iteración del ciclo principal. Gestiona la pausa, el movimiento
      del jugador y las pelotas, maneja las colisiones, y verifica las condiciones de fin de juego.
+     No lee el teclado: toda la entrada llega en `input`, así que también corre sin ventana.
 
    Params:
      gameState - Puntero al estado global del juego que contiene toda la información relevante para
                  actualizar la lógica del juego, como el jugador, las pelotas y los bloques.
+     input - Entrada del jugador para este paso (teclado, script o red).
 
    Returns:
      - void: Esta función no devuelve valores.
@@ -44,7 +55,9 @@ Consulta el archivo LICENSE para más detalles.
        deben estar correctamente implementadas para un funcionamiento esperado.
 
    Example:
-     update_game(&gameState);
+     TickInput input;
+     KeyboardInput_take(&input);
+     update_game(&gameState, &input);
      // Llama a esta función dentro del bucle principal del juego para mantener actualizada la lógica del juego.
 
    Problems:
@@ -55,22 +68,23 @@ Consulta el archivo LICENSE para más detalles.
      - Ninguna referencia externa específica.
 */
 
-void update_game(GameState *gameState) {
-    if (IsKeyPressed(KEY_P)) gameState->pause = !gameState->pause; // Alterna la pausa al presionar 'P'.
+void update_game(GameState *gameState, const TickInput *input) {
+    if (input->togglePause) gameState->pause = !gameState->pause; // Alterna la pausa al presionar 'P'.
 
     if (!gameState->pause) {
         // Actualiza el movimiento del jugador.
-        update_player_movement(&gameState->player, screenWidth);
+        update_player_movement(&gameState->player, screenWidth, gameState->tickSeconds, input, gameState->journal);
 
-        // Actualiza la posición de las pelotas.
-        update_ball_positions(&gameState->player, gameState->balls);
+        // Coloca las pelotas inactivas sobre la raqueta y lanza una si se pidió.
+        update_ball_positions(&gameState->player, &gameState->balls, input);
 
-        // Maneja las colisiones entre objetos del juego.
+        // Mueve las pelotas activas y resuelve sus colisiones.
         handle_collisions(gameState);
 
         // Verifica si todas las pelotas están inactivas y si ya se lanzaron.
-        if (noBallsActive(gameState->balls, gameState->maxBalls) && gameState->bolaLanzada) {
+        if (noBallsActive(&gameState->balls) && gameState->bolaLanzada) {
             gameState->player.life--;      // Resta una vida al jugador.
+            StateJournal_record(gameState->journal, JOURNAL_LIFE, gameState->player.life, 0);
             gameState->bolaLanzada = false; // Resetea el estado de lanzamiento.
         }
 
@@ -87,197 +101,309 @@ void update_game(GameState *gameState) {
 
     // Maneja la transición a reinicio del juego en caso de Game Over o victoria.
     if (gameState->gameOver && !gameState->winner) {
-        if (IsKeyPressed(KEY_ENTER)) gameState->restart = true;
+        if (input->confirm) gameState->restart = true;
     }
     // Maneja la transición a reinicio del juego en caso de Game Over o victoria.
     if (gameState->winner) {
-        if (IsKeyPressed(KEY_ENTER)) gameState->restart = true;
+        if (input->confirm) gameState->restart = true;
     }
 }
 
 
-/* Function: send_game_state_thread
+/* Function: init_match
    Descripción:
-     Hilo encargado de enviar el estado del juego a los clientes de forma periódica. Crea una copia local
-     del estado del juego protegido por un mutex para garantizar consistencia y evitar condiciones de carrera.
+     Prepara una partida nueva: jugador, pelotas, ladrillos y poderes, y limpia las banderas de fin de juego.
+     No toca la velocidad ni el nivel, que dependen de si la partida anterior se ganó o se perdió.
 
    Params:
-     arg - Puntero al estado global del juego (`GameState *`) que contiene toda la información necesaria
-           para enviar el estado del juego a los clientes.
+     gameState - Puntero al estado del juego a reiniciar.
 
    Returns:
-     - void*: Devuelve `NULL` al finalizar la ejecución del hilo.
+     - void: Esta función no devuelve valores.
 
    Restriction:
-     - Se debe garantizar que el `GameState` esté correctamente inicializado antes de pasar como argumento.
-     - El mutex `gameStateMutex` debe estar correctamente configurado para proteger el acceso al estado.
+     - `initGameState` debe haberse llamado antes, para que existan los arreglos de pelotas y ladrillos.
 
    Example:
-     pthread_t sendStateThread;
-     pthread_create(&sendStateThread, NULL, send_game_state_thread, (void *)&gameState);
-     // Crea un hilo para enviar el estado del juego periódicamente a los clientes.
+     init_match(getGameState());
+*/
 
-   Problems:
-     - Problema: Si el `GameState` es `NULL`, el hilo no puede proceder.
-       - Solución: Manejo temprano del error con un mensaje en `stderr` y terminación del hilo.
-     - Problema: Si no se usa correctamente el mutex, pueden ocurrir condiciones de carrera.
-       - Solución: Bloquear y desbloquear correctamente el mutex con `pthread_mutex_lock` y `pthread_mutex_unlock`.
+void init_match(GameState *gameState) {
+    // Inicializa al jugador con la vida máxima configurada.
+    init_player(&gameState->player, gameState->playerMaxLife);
 
-   References:
-     - pthread_mutex_lock: https://man7.org/linux/man-pages/man3/pthread_mutex_lock.3p.html
-     - usleep: https://man7.org/linux/man-pages/man3/usleep.3.html
-*/
+    // Inicializa las pelotas en el estado inicial.
+    init_balls(&gameState->balls);
 
-void *send_game_state_thread(void *arg) {
-    GameState *gameState = (GameState *)arg; // Castea el argumento al tipo `GameState`.
+    // Configura el tamaño de los ladrillos en función de las dimensiones de la pantalla y el número de ladrillos.
+    gameState->brickSize = (Vector2){
+        screenWidth / gameState->bricksPerLine,
+        screenHeight / (gameState->linesOfBricks * 2)
+    };
 
-    if (gameState == NULL) {
-        // Manejo de error si el estado del juego no está inicializado.
-        fprintf(stderr, "Error: gameState es NULL\n");
-        return NULL;
+    // Inicializa los ladrillos en el estado inicial del juego.
+    init_bricks(gameState, gameState->brickSize);
+
+    // Inicializa el manejador de poderes (bonificaciones).
+    initPowerHandler();
+
+    // Configura los valores iniciales del estado del juego.
+    gameState->restart = false;
+    gameState->pause = false;
+    gameState->winner = false;
+    gameState->gameOver = false;
+}
+
+
+/* Function: start_match
+   Descripción:
+     Empieza una partida nueva desde el primer nivel y a la velocidad inicial (a diferencia de `init_match`,
+     que conserva ambos), y la marca en la grabación de la sesión si la hay.
+
+   Params:
+     gameState - Puntero al estado del juego.
+
+   Returns:
+     - void: Esta función no devuelve valores.
+
+   Example:
+     start_match(gameState);
+*/
+
+void start_match(GameState *gameState) {
+    init_match(gameState);
+    gameState->ball_speed_multiplier = 1.0f;
+    gameState->levelsCompleted = 0;
+    if (gameState->recorder != NULL) {
+        ReplayRecorder_reset(gameState->recorder);
     }
+}
 
-    while (true) {
-        // Crear una copia local del estado del juego.
-        GameState localState;
 
-        // Bloquea el mutex para proteger el acceso al estado global del juego.
-        pthread_mutex_lock(&gameStateMutex);
-        bool isRunning = gameState->running; // Verifica si el juego sigue en ejecución.
-        if (isRunning) {
-            localState = *gameState; // Copia el estado del juego al local.
-        }
-        pthread_mutex_unlock(&gameStateMutex); // Desbloquea el mutex.
+/* Function: simulate_tick
+   Descripción:
+     Avanza la partida un paso fijo: aplica `update_game` y, si se confirmó el reinicio, pasa al siguiente
+     nivel (tras ganar) o vuelve al primero (tras perder). Es todo lo que necesita la pantalla GAME y lo que
+     ejecuta el binario sin ventana (`headless.c`).
 
-        if (!isRunning) {
-            break; // Termina el hilo si el juego no está en ejecución.
-        }
+   Params:
+     gameState - Puntero al estado del juego.
+     input - Entrada del jugador para este paso.
+
+   Returns:
+     - void: Esta función no devuelve valores.
+
+   Restriction:
+     - Se llama con `gameStateMutex` tomado cuando otros hilos leen el estado.
 
-        // Enviar el estado del juego usando la copia local.
-        sendGameState(&localState);
+   Example:
+     simulate_tick(gameState, &input);
+*/
 
-        // Pausa el hilo durante 20 ms (~0.02 segundos).
-        usleep(20000);
+void simulate_tick(GameState *gameState, const TickInput *input) {
+    if (gameState->recorder != NULL) {
+        ReplayRecorder_input(gameState->recorder, input);
     }
+    update_game(gameState, input);
 
-    return NULL; // Finaliza el hilo devolviendo `NULL`.
+    if (gameState->winner && gameState->restart) {
+        init_match(gameState);
+        gameState->ball_speed_multiplier += 0.25f;
+        gameState->levelsCompleted += 1;
+    }
+    // Reinicia el juego si se solicita
+    if (gameState->restart) {
+        init_match(gameState);
+        gameState->ball_speed_multiplier = 1.0f;
+        gameState->levelsCompleted = 0;
+    }
 }
 
 
+// Compara el estado con la última copia publicada para el envío. Los ladrillos, vidas, puntaje y la
+// raqueta quedan en la bitácora; las bolas y las banderas de la partida se comparan directamente.
+static bool state_changed(const GameState *gameState, const GameState *previous) {
+    const StateJournal *journal = gameState->journal;
+    if (journal->count > 0 || journal->dirty != 0 || journal->fullSync) {
+        return true;
+    }
+    if (gameState->player.position.x != previous->player.position.x
+        || gameState->player.position.y != previous->player.position.y
+        || gameState->player.size.x != previous->player.size.x
+        || gameState->levelsCompleted != previous->levelsCompleted
+        || gameState->gameOver != previous->gameOver
+        || gameState->pause != previous->pause
+        || gameState->winner != previous->winner
+        || gameState->bolaLanzada != previous->bolaLanzada) {
+        return true;
+    }
 
-/* Function: generate_GameState_json
+    const BallPool *balls = &gameState->balls;
+    return memcmp(balls->active, previous->balls.active, (size_t)balls->words * sizeof(uint64_t)) != 0
+        || memcmp(balls->x, previous->balls.x, (size_t)balls->capacity * sizeof(float)) != 0
+        || memcmp(balls->y, previous->balls.y, (size_t)balls->capacity * sizeof(float)) != 0;
+}
+
+/* Function: broadcast_tick
    Descripción:
-     Genera una representación JSON del estado actual del juego a partir del objeto `GameState`.
-     Incluye información sobre el jugador, las pelotas activas, los ladrillos, y el estado general del juego.
+     Decide, una vez por paso de simulación, si se publica el estado para el hilo de envío. Se publica cada
+     `gameState->broadcastEvery` pasos y, con `broadcastOnChange`, sólo si algo cambió desde la última
+     publicación. La publicación despierta a `send_game_state_thread`, así que los envíos quedan alineados
+     con los pasos: ni se repite un estado ni se salta uno que tocaba enviar.
 
    Params:
-     gameState - Puntero al estado global del juego (`GameState *`), que contiene todos los detalles necesarios
-                 para construir la representación JSON.
+     gameState - Puntero al estado del juego.
 
    Returns:
-     - char*: Cadena de texto con la representación JSON del estado del juego.
-       Nota: La memoria de la cadena debe liberarse después de usarla para evitar fugas de memoria.
+     - void: Esta función no devuelve valores.
 
    Restriction:
-     - Se debe garantizar que el `gameState` esté correctamente inicializado antes de llamar a esta función.
-     - El llamador debe liberar la memoria de la cadena JSON devuelta con `free`.
+     - Sólo desde el hilo de la simulación, después de cada paso y con `gameStateMutex` tomado.
 
    Example:
-     GameState *gameState = getGameState();
-     char *jsonString = generate_GameState_json(gameState);
-     printf("JSON: %s\n", jsonString);
-     free(jsonString); // Liberar la memoria asignada.
+     simulate_tick(gameState, &input);
+     broadcast_tick(gameState);
 
    Problems:
-     - Problema: Si algún campo del `GameState` no está inicializado, los datos generados en el JSON pueden
-       ser inconsistentes o incorrectos.
-       - Solución: Garantizar que los campos del `GameState` estén completamente inicializados antes de llamar
-         a esta función.
-
-   References:
-     - cJSON Documentation: https://github.com/DaveGamble/cJSON
+     - Problema: Con el juego en pausa se seguía enviando el mismo estado 50 veces por segundo.
+       - Solución: Sin cambios no se publica, y sin publicación el hilo de envío no despierta.
+     - Problema: Los cambios de los pasos que no se publican no deben perderse.
+       - Solución: Se quedan en `gameState->journal` hasta la siguiente publicación.
 */
 
-char* generate_GameState_json(GameState *gameState) {
-    // Crear el objeto JSON raíz
-    cJSON *gameStateJSON = cJSON_CreateObject();
-
-    cJSON_AddStringToObject(gameStateJSON, "command", "sendGameState");
-
-    // Agregar información del jugador
-    cJSON *playerJSON = cJSON_CreateObject();
-    cJSON_AddNumberToObject(playerJSON, "positionX", gameState->player.position.x);
-    cJSON_AddNumberToObject(playerJSON, "positionY", gameState->player.position.y);
-    cJSON_AddNumberToObject(playerJSON, "sizeX", gameState->player.size.x);
-    cJSON_AddNumberToObject(playerJSON, "sizeY", gameState->player.size.y);
-    cJSON_AddNumberToObject(playerJSON, "lives", gameState->player.life);
-    cJSON_AddNumberToObject(playerJSON, "score", gameState->player.score);
-    cJSON_AddItemToObject(gameStateJSON, "player", playerJSON);
-
-    // Agregar información de las pelotas activas
-    cJSON *ballsArray = cJSON_CreateArray();
-    for (int i = 0; i < gameState->maxBalls; i++) {
-        cJSON *ballJSON = cJSON_CreateObject();
-        cJSON_AddBoolToObject(ballJSON, "active", gameState->balls[i].active);
-        cJSON_AddNumberToObject(ballJSON, "positionX", gameState->balls[i].position.x);
-        cJSON_AddNumberToObject(ballJSON, "positionY", gameState->balls[i].position.y);
-        cJSON_AddItemToArray(ballsArray, ballJSON);
+void broadcast_tick(GameState *gameState) {
+    if (++gameState->broadcastTicks < gameState->broadcastEvery) {
+        return;
     }
-    cJSON_AddItemToObject(gameStateJSON, "balls", ballsArray);
-
-    // Agregar información de los ladrillos activos
-    cJSON *bricksArray = cJSON_CreateArray();
-    for (int i = 0; i < gameState->linesOfBricks; i++) {
-        for (int j = 0; j < gameState->bricksPerLine; j++) {
-            cJSON *brickJSON = cJSON_CreateObject();
-            cJSON_AddBoolToObject(brickJSON, "active", gameState->bricks[i][j].active);
-            cJSON_AddItemToArray(bricksArray, brickJSON);
-        }
+    gameState->broadcastTicks = 0;
+
+    const GameSnapshot *previous = SnapshotBuffer_lastPublished(gameState->networkSnapshots);
+    if (gameState->broadcastOnChange && !state_changed(gameState, &previous->state)) {
+        return;
     }
-    cJSON_AddItemToObject(gameStateJSON, "bricks", bricksArray);
+    SnapshotBuffer_publish(gameState->networkSnapshots, gameState, gameState->journal);
+}
 
-    // Agregar estado general del juego
-    cJSON_AddBoolToObject(gameStateJSON, "gameOver", gameState->gameOver);
-    cJSON_AddBoolToObject(gameStateJSON, "paused", gameState->pause);
-    cJSON_AddBoolToObject(gameStateJSON, "winner", gameState->winner);
-    cJSON_AddNumberToObject(gameStateJSON, "levelsCompleted", gameState->levelsCompleted);
 
-    // Convertir el objeto JSON a una cadena
-    char *jsonString = cJSON_PrintUnformatted(gameStateJSON);
+/* Function: send_game_state_thread
+   Descripción:
+     Hilo encargado de enviar el estado del juego a los clientes. Duerme hasta que la simulación publica una
+     copia en `gameState->networkSnapshots` (`broadcast_tick`) y la envía junto con los cambios que trae desde
+     la copia anterior. No toma `gameStateMutex` ni tiene un temporizador propio.
 
-    // Liberar memoria utilizada por cJSON
-    cJSON_Delete(gameStateJSON);
+   Params:
+     arg - Puntero al estado global del juego (`GameState *`) que contiene toda la información necesaria
+           para enviar el estado del juego a los clientes.
 
-    return jsonString;  // Recordar liberar esta memoria con `free`
+   Returns:
+     - void*: Devuelve `NULL` al finalizar la ejecución del hilo.
+
+   Restriction:
+     - Se debe garantizar que el `GameState` esté correctamente inicializado antes de pasar como argumento.
+     - Es el único lector de `gameState->networkSnapshots`.
+
+   Example:
+     pthread_t sendStateThread;
+     pthread_create(&sendStateThread, NULL, send_game_state_thread, (void *)&gameState);
+     // Crea un hilo para enviar el estado del juego periódicamente a los clientes.
+
+   Problems:
+     - Problema: Si el `GameState` es `NULL`, el hilo no puede proceder.
+       - Solución: Manejo temprano del error con un mensaje en `stderr` y terminación del hilo.
+     - Problema: La copia `localState = *gameState` tomada con el mutex compartía los arreglos de ladrillos y
+       bolas con la simulación, que los seguía modificando durante la serialización.
+       - Solución: Las copias del `SnapshotBuffer` tienen arreglos propios que nadie escribe mientras se envían.
+
+     - Problema: Con un temporizador propio (`usleep(20000)`) el envío no coincidía con los pasos: a veces
+       repetía un estado y a veces se saltaba uno.
+       - Solución: El hilo espera la publicación de la simulación con `SnapshotBuffer_wait`.
+
+   References:
+     - eventfd: https://man7.org/linux/man-pages/man2/eventfd.2.html
+*/
+
+#define SEND_STATE_WAIT_MS 100
+
+void *send_game_state_thread(void *arg) {
+    GameState *gameState = (GameState *)arg; // Castea el argumento al tipo `GameState`.
+
+    if (gameState == NULL) {
+        // Manejo de error si el estado del juego no está inicializado.
+        fprintf(stderr, "Error: gameState es NULL\n");
+        return NULL;
+    }
+
+    while (gameState->running) { // Termina el hilo cuando el juego deja de ejecutarse.
+        // Espera la siguiente publicación; el límite sólo sirve para revisar `running`.
+        SnapshotBuffer_wait(gameState->networkSnapshots, SEND_STATE_WAIT_MS);
+
+        // Toma la última copia publicada por la simulación; sus cambios cubren todo lo no enviado.
+        bool isNew;
+        const GameSnapshot *snapshot = SnapshotBuffer_read(gameState->networkSnapshots, &isNew);
+        if (isNew) {
+            sendGameState(&snapshot->state, &snapshot->journal);
+        }
+    }
+
+    return NULL; // Finaliza el hilo devolviendo `NULL`.
 }
 
 
+
 /* Function: sendGameState
    Descripción:
-     Envía el estado actual del juego a través del servidor de comunicación en formato JSON.
+     Envía el estado actual del juego a través del servidor de comunicación. Si `network.stateFormat`
+     es "binary" se envían tramas binarias con deltas (ver `stateCodec.h`); de lo contrario se usa JSON.
 
    Params:
      gameState - Puntero al estado global del juego (`GameState *`) que contiene la información
                  necesaria para generar y enviar el estado del juego.
+     journal - Cambios registrados desde el envío anterior, o `NULL` para procesar el estado completo.
 
    Returns:
      - void: Esta función no devuelve valores.
 
    Restriction:
      - Se debe garantizar que `gameState` esté correctamente inicializado antes de llamar a esta función.
-     - La función `generate_GameState_json` debe estar correctamente implementada.
+     - El JSON se escribe en el buffer del hilo que llama (`JsonWriter_threadInstance`), por lo que no
+       se reserva memoria por envío.
 
    Example:
      GameState *gameState = getGameState();
-     sendGameState(gameState);
+     sendGameState(gameState, NULL);
      // Envía el estado actual del juego a los clientes conectados.
 
 */
 
-void sendGameState(GameState *gameState) {
-    const char *json = generate_GameState_json(gameState); // Generar el estado del juego en formato JSON.
-    if (json != NULL) {
-        ComServer_sendStatus(json); // Enviar el estado del juego al servidor de comunicación.
+void sendGameState(const GameState *gameState, const StateJournal *journal) {
+    static StateEncoder *encoder = NULL;
+
+    const char *format = get_config_string("network.stateFormat");
+    if (format != NULL && strcmp(format, "binary") == 0) {
+        if (encoder == NULL) {
+            encoder = StateEncoder_create(gameState->linesOfBricks, gameState->bricksPerLine, gameState->maxBalls);
+        }
+        if (encoder != NULL) {
+            const uint8_t *frame;
+            size_t length = StateEncoder_encode(encoder, gameState, journal, &frame);
+            char *message = StateCodec_createMessage(frame, length);
+            if (message != NULL) {
+                ComServer_sendStatus(message);
+            }
+            return;
+        }
+    }
+
+    JsonWriter *writer = JsonWriter_threadInstance();
+    if (writer == NULL) {
+        fprintf(stderr, "Error: No se pudo crear el escritor JSON\n");
+        return;
+    }
+
+    JsonWriter_reset(writer);
+    write_GameState_json(writer, gameState); // Generar el estado del juego en formato JSON.
+    if (!writer->failed) {
+        ComServer_sendBuffer(writer->data); // Enviar el estado del juego al servidor de comunicación.
     }
 }
 
@@ -327,7 +453,8 @@ PowerType get_power_type(const char* power_str) {
 /* Function: process_brick_update
    Descripción:
      Procesa una actualización de un ladrillo basado en un comando recibido en formato JSON.
-     Extrae la fila, la columna y el tipo de poder del JSON para aplicar la acción correspondiente.
+     Extrae y valida la fila, la columna y el tipo de poder del JSON, y encola el resultado en
+     `gameState->commands`; la simulación aplica la acción en su siguiente paso (`apply_game_commands`).
 
    Params:
      json_command - Cadena en formato JSON que contiene los datos necesarios para actualizar un ladrillo.
@@ -342,17 +469,24 @@ PowerType get_power_type(const char* power_str) {
    Restriction:
      - `json_command` debe ser un JSON válido con los campos necesarios.
      - El estado del juego (`GameState`) debe estar correctamente inicializado y accesible.
+     - Sólo desde el hilo del reactor de red, el único productor de la cola. No toma `gameStateMutex`.
 
    Example:
      const char *command = "{\"row\": 2, \"column\": 3, \"power\": \"ADD_LIFE\"}";
      process_brick_update(command);
-     // Actualiza el ladrillo en la fila 2, columna 3, aplicando el poder "ADD_LIFE".
+     // En el siguiente paso el ladrillo de la fila 2, columna 3 recibe el poder "ADD_LIFE".
 
    Problems:
      - Problema: Si el JSON no es válido o le faltan campos requeridos, no se aplicará ninguna acción.
        - Solución: Validar el formato del JSON antes de llamarlo y manejar los errores de parsing.
      - Problema: Si los índices de fila o columna están fuera de los límites del tablero, no se aplica ninguna acción.
        - Solución: Garantizar que los valores de "row" y "column" estén dentro de los límites definidos.
+     - Problema: El poder se escribía en el ladrillo desde el hilo de red, sin el mutex, mientras la
+       simulación lo leía.
+       - Solución: Aquí sólo se interpreta el mensaje; el cambio lo hace la simulación al vaciar la cola.
+     - Problema: Si la cola está llena, el comando se pierde.
+       - Solución: Se avisa en `stderr`; la simulación vacía la cola en cada paso, así que sólo ocurre si
+         llegan más de `COMMAND_QUEUE_CAPACITY` mensajes entre dos pasos.
 
    References:
      - cJSON Documentation: https://github.com/DaveGamble/cJSON
@@ -398,7 +532,30 @@ void process_brick_update(const char* json_command) {
         return;
     }
 
-    // Aplicar la acción correspondiente según el tipo de poder.
+    if (power == NONE) {
+        printf("No action for power: %s\n", power_str);
+        cJSON_Delete(root);
+        return;
+    }
+
+    // Encolar el comando; la simulación lo aplica en su siguiente paso.
+    GameCommand *command = CommandQueue_reserve(gameState->commands);
+    if (command == NULL) {
+        fprintf(stderr, "Cola de comandos llena, se descarta el poder %s\n", power_str);
+    } else {
+        command->type = GAME_COMMAND_BRICK_POWER;
+        command->row = row;
+        command->column = column;
+        command->power = power;
+        CommandQueue_commit(gameState->commands);
+    }
+
+    // Liberar memoria asignada por cJSON.
+    cJSON_Delete(root);
+}
+
+// Aplica a un ladrillo el poder que llegó del servidor (con UPDATE_POINTS, `row` es el nivel y `column` los puntos)
+static void apply_brick_power(int row, int column, PowerType power) {
     switch (power) {
         case ADD_LIFE:
             update_brick_life(row, column);
@@ -422,11 +579,47 @@ void process_brick_update(const char* json_command) {
             update_brick_score(row, column);
             break;
         default:
-            printf("No action for power: %s\n", power_str);
             break;
     }
+}
 
-    // Liberar memoria asignada por cJSON.
-    cJSON_Delete(root);
+/* Function: apply_game_commands
+   Descripción:
+     Vacía la cola de comandos de la red (`gameState->commands`) y los aplica al estado del juego en el
+     orden en que llegaron: poderes de ladrillos para el jugador y estados recibidos para el espectador.
+     Los estados recibidos no se copian al estado del juego: se guardan en `gameState->playout`, de donde
+     los toma la pantalla SPECTATOR con el retraso de reproducción.
+     Los poderes se graban en `gameState->recorder`, si lo hay, en el paso en que se aplican.
+
+   Params:
+     gameState - Puntero al estado del juego.
+
+   Returns:
+     - void: Esta función no devuelve valores.
+
+   Restriction:
+     - Sólo desde el hilo de la simulación, al inicio de cada paso y con `gameStateMutex` tomado.
+
+   Example:
+     apply_game_commands(gameState);
+     simulate_tick(gameState, &input);
+*/
+
+void apply_game_commands(GameState *gameState) {
+    const GameCommand *command;
+    while ((command = CommandQueue_peek(gameState->commands)) != NULL) {
+        switch (command->type) {
+            case GAME_COMMAND_BRICK_POWER:
+                if (gameState->recorder != NULL) {
+                    ReplayRecorder_brick(gameState->recorder, command->row, command->column, command->power);
+                }
+                apply_brick_power(command->row, command->column, command->power);
+                break;
+            case GAME_COMMAND_SPECTATOR_STATE:
+                JitterBuffer_push(gameState->playout, command->state, command->receivedAt);
+                break;
+        }
+        CommandQueue_release(gameState->commands);
+    }
 }
 
@@ -12,12 +12,18 @@ Consulta el archivo LICENSE para más detalles.
 #define GAME_LOGIC_H
 
 #include "../game_status.h"
+#include "tickInput.h"
 
 
 extern pthread_t sendStateThread;
 void *send_game_state_thread(void *arg);
-void update_game(GameState* gameState);
-void sendGameState(GameState *gameState);
+void update_game(GameState* gameState, const TickInput *input);
+void init_match(GameState *gameState);
+void start_match(GameState *gameState);
+void simulate_tick(GameState *gameState, const TickInput *input);
+void sendGameState(const GameState *gameState, const StateJournal *journal);
 void process_brick_update(const char* json_command);
+void apply_game_commands(GameState *gameState);
+void broadcast_tick(GameState *gameState);
 
 #endif // GAME_LOGIC_H
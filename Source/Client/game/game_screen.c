@@ -12,8 +12,12 @@ Consulta el archivo LICENSE para más detalles.
 // BIBLIOTECAS DE PROYECTO
 #include "game_screen.h"
 #include "Objects/ball.h"
+#include "Objects/brick.h"
+#include "brickBatch.h"
 
 
+// Malla de los ladrillos; vive en el hilo de dibujo mientras la ventana esté abierta
+static BrickBatch *brickBatch = NULL;
 
 /* Function: draw_game
    Descripción:
@@ -74,34 +78,27 @@ void draw_game(const GameState *gameState) {
         DrawText(TextFormat("LEVEL: %01i", gameState->levelsCompleted), GetScreenWidth() - 120, 10, 20, DARKGRAY);
 
         //Dibujar bola inicial
-        if (noBallsActive(gameState->balls, gameState->maxBalls) &&
+        if (noBallsActive(&gameState->balls) &&
             !gameState->bolaLanzada) {
-            DrawCircleV(gameState->balls[0].position, gameState->balls[0].radius, MAROON);
+            DrawCircleV(ball_position(&gameState->balls, 0), gameState->balls.radius[0], MAROON);
         }
 
 
-        // Dibujar todas las bolas activas desde el arreglo dinámico
-        for (int i = 0; i < gameState->maxBalls; i++) {
-            if (gameState->balls[i].active) {
-                DrawCircleV(gameState->balls[i].position, gameState->balls[i].radius, MAROON);
+        // Dibujar todas las bolas activas, recorriendo sólo los bits encendidos
+        const BallPool *balls = &gameState->balls;
+        for (int word = 0; word < balls->words; word++) {
+            for (uint64_t bits = balls->active[word]; bits != 0; bits &= bits - 1) {
+                int i = word * 64 + __builtin_ctzll(bits);
+                DrawCircleV(ball_position(balls, i), balls->radius[i], MAROON);
             }
         }
 
-        // Dibujar los ladrillos activos con color según la línea
-        for (int i = 0; i < gameState->linesOfBricks; i++) {
-            for (int j = 0; j < gameState->bricksPerLine; j++) {
-                // Verificar si el ladrillo está activo
-                if (gameState->bricks[i][j].active) {
-                    // Calcular las posiciones y tamaños de los ladrillos
-                    float x = gameState->bricks[i][j].position.x - (gameState->brickSize.x / 2) + brickSpacing / 2;
-                    float y = gameState->bricks[i][j].position.y - (gameState->brickSize.y / 2) + brickSpacing / 2;
-                    float width = gameState->brickSize.x - brickSpacing;
-                    float height = gameState->brickSize.y - brickSpacing;
-
-                    // Dibujar el ladrillo
-                    DrawRectangle(x, y, width, height, gameState->bricks[i][j].color);
-                }
-            }
+        // Dibujar los ladrillos activos en una sola llamada; la malla se reconstruye sólo si cambiaron
+        if (brickBatch == NULL) {
+            brickBatch = BrickBatch_create(&gameState->bricks);
+        }
+        if (brickBatch != NULL) {
+            BrickBatch_draw(brickBatch, gameState);
         }
         }
         else {
@@ -140,3 +137,25 @@ void draw_game(const GameState *gameState) {
 
     EndDrawing();
 }
+
+/* Function: release_game_screen
+   Descripción:
+     Libera los recursos de la GPU que `draw_game` crea la primera vez que dibuja (la malla de ladrillos).
+
+   Params:
+     (Ninguno)
+
+   Returns:
+     - void: Esta función no devuelve valores.
+
+   Restriction:
+     - Desde el hilo de dibujo, antes de `CloseWindow`.
+
+   Example:
+     release_game_screen();
+     CloseWindow();
+*/
+void release_game_screen() {
+    BrickBatch_destroy(brickBatch);
+    brickBatch = NULL;
+}
@@ -14,6 +14,7 @@ Consulta el archivo LICENSE para más detalles.
 #include "../game_status.h"
 
 void draw_game(const GameState *game_status);
+void release_game_screen();
 
 #endif // GAME_SCREEN_H
 
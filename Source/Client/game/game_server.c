@@ -14,6 +14,8 @@ Consulta el archivo LICENSE para más detalles.
 #include <stdio.h>   // Funciones de entrada y salida estándar (e.g., printf, scanf, etc.).
 #include <stdlib.h>  // Funciones generales de propósito, como gestión de memoria (e.g., malloc, free, etc.).
 #include <unistd.h>  // Funciones para operaciones del sistema POSIX (e.g., sleep, close, etc.).
+#include <errno.h>   // EINTR.
+#include <time.h>    // Reloj monótono y espera absoluta (clock_gettime, clock_nanosleep).
 
 // BIBLIOTECAS DE PROYECTO
 #include "game_logic.h"       // Lógica principal del juego.
@@ -24,6 +26,11 @@ Consulta el archivo LICENSE para más detalles.
 #include "Objects/player.h"   // Implementación y lógica del jugador.
 #include "powerHandler.h"     // Manejo de poderes y bonificaciones.
 #include "../gui/screenHandler.h" // Manejo de pantallas de la interfaz gráfica.
+#include "../gui/keyboardInput.h" // Entrada del teclado para cada paso de simulación.
+#include "snapshotBuffer.h"   // Copias del estado para los hilos de dibujo y envío.
+#include "replayLog.h"        // Grabación de la sesión.
+#include "jitterBuffer.h"     // Estados recibidos por el espectador.
+#include "../configuracion/configuracion.h" // Archivo de la grabación (game.recordFile).
 
 // Variables Globales
 pthread_t askForUserThread; // Hilo para manejar la interacción con el usuario.
@@ -31,7 +38,8 @@ pthread_t askForUserThread; // Hilo para manejar la interacción con el usuario.
 /* Function: init_game_server
    Descripción:
      Inicializa el servidor del juego configurando el estado inicial del juego,
-     incluyendo al jugador, las pelotas, los ladrillos y los manejadores de poder.
+     incluyendo al jugador, las pelotas, los ladrillos y los manejadores de poder, desde el primer nivel
+     (ver `start_match`).
 
    Params:
      (Ninguno)
@@ -54,38 +62,13 @@ pthread_t askForUserThread; // Hilo para manejar la interacción con el usuario.
 */
 
 void init_game_server() {
-    GameState *gameStatus = getGameState(); // Obtiene el estado global del juego.
-
-    // Inicializa al jugador con la vida máxima configurada.
-    init_player(&gameStatus->player, gameStatus->playerMaxLife);
-
-    // Inicializa las pelotas en el estado inicial.
-    init_balls(gameStatus->balls);
-
-    // Configura el tamaño de los ladrillos en función de las dimensiones de la pantalla y el número de ladrillos.
-    brickSize = (Vector2){
-        screenWidth / gameStatus->bricksPerLine,
-        screenHeight / (gameStatus->linesOfBricks * 2)
-    };
-    gameStatus->brickSize = brickSize;
-
-    // Inicializa los ladrillos en el estado inicial del juego.
-    init_bricks(gameStatus, gameStatus->brickSize);
-
-    // Inicializa el manejador de poderes (bonificaciones).
-    initPowerHandler();
-
-    // Configura los valores iniciales del estado del juego.
-    gameStatus->restart = false;
-    gameStatus->pause = false;
-    gameStatus->winner = false;
-    gameStatus->gameOver = false;
-
+    start_match(getGameState()); // Jugador, pelotas, ladrillos y poderes de una partida nueva.
 }
 
 /* Function: gameServerCallback
    Descripción:
-     Procesa los mensajes recibidos del servidor del juego, actualizando el estado de los ladrillos.
+     Procesa los mensajes recibidos del servidor del juego: encola las actualizaciones de los ladrillos
+     para que las aplique la simulación.
 
    Params:
      recibido - Mensaje recibido como una cadena de caracteres que contiene información sobre
@@ -104,7 +87,7 @@ void init_game_server() {
 */
 
 void gameServerCallback(const char *recibido) {
-    process_brick_update(recibido); // Procesa las actualizaciones de ladrillos a partir del mensaje recibido.
+    process_brick_update(recibido); // Interpreta el mensaje y encola la actualización del ladrillo.
 }
 
 /* Function: updateNameInput
@@ -163,7 +146,8 @@ void updateNameInput(GameState *game_state) {
 /* Function: initialize_game_communication
    Descripción:
      Inicializa la comunicación del juego configurando el servidor de comunicación (ComServer)
-     y creando un hilo para escuchar mensajes. Si ya existe una instancia de ComServer, no se vuelve a crear.
+     y asegurando que su reactor de red esté corriendo. Si ya existe una instancia de ComServer, no se vuelve
+     a crear, y el reactor nunca se duplica aunque se llame desde varias pantallas.
 
    Params:
      gameState - Puntero al estado global del juego que contiene la configuración actual del juego,
@@ -182,7 +166,7 @@ void updateNameInput(GameState *game_state) {
      // Configura la comunicación del juego con un callback para procesar mensajes.
 
    Problems:
-     - Problema: Si no se puede crear el ComServer o el hilo de comunicación, el juego no podrá continuar.
+     - Problema: Si no se puede crear el ComServer o el reactor de red, el juego no podrá continuar.
        - Solución: Se imprime un mensaje de error en la salida estándar de error (stderr)
          y se detiene el estado de ejecución (`gameState->running = false`).
 
@@ -205,14 +189,10 @@ void initialize_game_communication(GameState *gameState, void (*callback)(void *
         ComServer_registerCallback(gameState->comServer, callback);
     }
 
-    // Crea un hilo para escuchar los mensajes del servidor de comunicación.
-    if (pthread_create(
-            &gameState->communicationThread,
-            NULL,
-            ComServer_messageListeningLoop,
-            (void *)gameState->comServer) != 0) {
-        // Si la creación del hilo falla, muestra un mensaje de error, destruye el ComServer y detiene el juego.
-        fprintf(stderr, "Error al crear el hilo de comunicación\n");
+    // Asegura que el reactor de red (único hilo dueño del socket) esté corriendo.
+    if (!ComServer_start(gameState->comServer)) {
+        // Si el reactor no puede iniciar, muestra un mensaje de error, destruye el ComServer y detiene el juego.
+        fprintf(stderr, "Error al iniciar el reactor de red\n");
         ComServer_destroy(gameState->comServer); // Libera recursos del servidor de comunicación.
         gameState->running = false; // Indica que el juego no está en ejecución.
     }
@@ -224,11 +204,14 @@ void initialize_game_communication(GameState *gameState, void (*callback)(void *
 /* Function: update_game_state
    Descripción:
      Actualiza el estado del juego basado en la pantalla actual, gestionando las transiciones entre pantallas,
-     la inicialización de la comunicación y la lógica principal del juego.
+     la inicialización de la comunicación y la lógica principal del juego. Antes aplica los comandos que
+     el hilo de red dejó en `gameState->commands`. En la pantalla SPECTATOR el estado que se muestra es el
+     del jugador observado, tomado de `gameState->playout`.
 
    Params:
      gameState - Puntero al estado global del juego que contiene toda la información relevante para
                  gestionar las pantallas y la lógica del juego.
+     input - Entrada del jugador para este paso; sólo la usa la pantalla GAME.
 
    Returns:
      - void: Esta función no devuelve valores.
@@ -238,7 +221,7 @@ void initialize_game_communication(GameState *gameState, void (*callback)(void *
      - Las transiciones entre pantallas deben manejarse según las reglas establecidas en el juego.
 
    Example:
-     update_game_state(&gameState);
+     update_game_state(&gameState, &input);
      // Se utiliza en el bucle principal del juego para actualizar su estado.
 
    Problems:
@@ -250,7 +233,10 @@ void initialize_game_communication(GameState *gameState, void (*callback)(void *
         Man7.org. Recuperado de https://man7.org/linux/man-pages/man3/pthread_create.3.html
 */
 
-void update_game_state(GameState *gameState) {
+void update_game_state(GameState *gameState, const TickInput *input) {
+    // Aplica los comandos que llegaron por la red desde el paso anterior
+    apply_game_commands(gameState);
+
     // Determina la acción según la pantalla actual
     switch (getCurrentScreen()) {
         case MENU:
@@ -282,20 +268,8 @@ void update_game_state(GameState *gameState) {
                 }
             }
 
-            // Actualiza la lógica principal del juego
-            update_game(gameState);
-
-            if (gameState->winner && gameState->restart) {
-                init_game_server();
-                gameState->ball_speed_multiplier+=0.25f;
-                gameState->levelsCompleted+=1;
-            }
-            // Reinicia el juego si se solicita
-            if (gameState->restart) {
-                init_game_server();
-                gameState->ball_speed_multiplier=1.0f;
-                gameState->levelsCompleted=0;
-            }
+            // Actualiza la lógica principal del juego (incluye el reinicio o el cambio de nivel)
+            simulate_tick(gameState, input);
             break;
 
         case OBSERVER_SELECT: {
@@ -333,8 +307,12 @@ void update_game_state(GameState *gameState) {
                 gameState->comunicationRunning = true;
                 gameState->comServer = NULL;
 
+                // El búfer se vació en UpdatePlayerList y puede tener ya el estado inicial del jugador
                 initialize_game_communication(gameState, espectadorUpdateGame);
             }
+
+            // Muestra el estado del jugador observado con el retraso de reproducción, interpolado
+            JitterBuffer_sample(gameState->playout, gameState, JitterBuffer_now());
             break;
 
         default:
@@ -356,7 +334,13 @@ void update_game_state(GameState *gameState) {
 /* Function: update_thread
    Descripción:
      Hilo encargado de actualizar el estado del juego de forma continua mientras el juego está en ejecución.
+     Usa un paso de simulación fijo (`gameState->tickSeconds`, configurable con `game.tickRate`): mide el
+     tiempo real transcurrido con `CLOCK_MONOTONIC`, lo acumula y ejecuta tantos pasos completos como quepan.
+     Después duerme hasta el instante exacto del siguiente paso con `clock_nanosleep(TIMER_ABSTIME)`.
      La función bloquea el mutex global durante la actualización para garantizar la sincronización entre hilos.
+     Al terminar los pasos publica una copia del estado para el hilo de dibujo (`SnapshotBuffer_publish`);
+     la del hilo de envío se decide en cada paso con `broadcast_tick`. Esos hilos leen su copia sin tomar
+     el mutex.
 
    Params:
      arg - Puntero al estado global del juego (`GameState *`), que contiene toda la información necesaria
@@ -377,25 +361,63 @@ void update_game_state(GameState *gameState) {
    Problems:
      - Problema: Si el mutex no se desbloquea correctamente, podría causar un bloqueo (deadlock).
        - Solución: Asegurarse de que todas las rutas de ejecución liberen el mutex antes de salir.
+     - Problema: Con `usleep` fijo la velocidad del juego dependía de cuánto tardaba la actualización y del
+       planificador del sistema.
+       - Solución: Paso fijo con acumulador; la física avanza siempre `tickSeconds` por paso.
+     - Problema: Si la máquina se atrasa mucho, el acumulador exigiría cada vez más pasos (espiral de muerte).
+       - Solución: Se limita el atraso acumulado a `MAX_CATCH_UP_TICKS` pasos; el resto se descarta.
 
    References:
      - pthread_mutex_lock: https://man7.org/linux/man-pages/man3/pthread_mutex_lock.3p.html
-     - usleep: https://man7.org/linux/man-pages/man3/usleep.3.html
+     - clock_nanosleep: https://man7.org/linux/man-pages/man2/clock_nanosleep.2.html
+     - Fiedler, G. Fix Your Timestep!: https://gafferongames.com/post/fix_your_timestep/
 */
 
+#define NANOS_PER_SECOND 1000000000LL
+#define MAX_CATCH_UP_TICKS 5
+
+static long long monotonic_nanos() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * NANOS_PER_SECOND + now.tv_nsec;
+}
+
 void *update_thread(void *arg) {
     GameState *gameState = (GameState *)arg; // Castea el argumento a GameState.
+    const long long tickNanos = NANOS_PER_SECOND / gameState->tickRate;
+    long long previous = monotonic_nanos();
+    long long accumulator = 0;
 
     while (gameState->running) { // Bucle principal: el hilo se ejecuta mientras el juego está activo.
-        pthread_mutex_lock(&gameStateMutex); // Bloquea el mutex para sincronizar el acceso al estado del juego.
+        long long now = monotonic_nanos();
+        accumulator += now - previous;
+        previous = now;
+        if (accumulator > MAX_CATCH_UP_TICKS * tickNanos) {
+            accumulator = MAX_CATCH_UP_TICKS * tickNanos;
+        }
+
+        if (accumulator >= tickNanos) {
+            pthread_mutex_lock(&gameStateMutex); // Bloquea el mutex para sincronizar el acceso al estado del juego.
 
-        // Actualiza el estado del juego según la pantalla actual.
-        update_game_state(gameState);
+            // Actualiza el estado del juego según la pantalla actual, un paso fijo a la vez.
+            while (accumulator >= tickNanos) {
+                TickInput input;
+                KeyboardInput_take(&input); // Cada pulsación se consume en un solo paso.
+                update_game_state(gameState, &input);
+                broadcast_tick(gameState); // Despierta al hilo de envío si toca enviar este paso.
+                accumulator -= tickNanos;
+            }
 
-        pthread_mutex_unlock(&gameStateMutex); // Desbloquea el mutex tras la actualización.
+            // Publica el resultado para el dibujo; el envío se publica por paso en `broadcast_tick`.
+            SnapshotBuffer_publish(gameState->renderSnapshots, gameState, NULL);
 
-        // Pausa para limitar la velocidad de actualización (~60 FPS).
-        usleep(16000);
+            pthread_mutex_unlock(&gameStateMutex); // Desbloquea el mutex tras la actualización.
+        }
+
+        // Duerme hasta el instante del siguiente paso.
+        long long wakeAt = now + (tickNanos - accumulator);
+        struct timespec deadline = { wakeAt / NANOS_PER_SECOND, wakeAt % NANOS_PER_SECOND };
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {}
     }
 
     return NULL; // Finaliza la ejecución del hilo devolviendo NULL.
@@ -451,6 +473,15 @@ void start_game() {
     // Configura el estado inicial del juego.
     gameState->running = true;
 
+    // Graba la sesión si `game.recordFile` indica un archivo (se repite con `ClientHeadless --replay`).
+    const char *recordFile = get_config_string("game.recordFile");
+    if (recordFile != NULL && recordFile[0] != '\0') {
+        gameState->recorder = ReplayRecorder_open(recordFile, gameState);
+        if (gameState->recorder == NULL) {
+            fprintf(stderr, "No se pudo crear la grabación %s\n", recordFile);
+        }
+    }
+
     // Crea e inicia el hilo para la actualización del estado del juego.
     if (pthread_create(&updateThread, NULL, update_thread, (void *)gameState) != 0) {
         fprintf(stderr, "Error al crear el thread de actualización\n");
@@ -469,6 +500,10 @@ void start_game() {
     pthread_join(updateThread, NULL); // Espera la finalización del hilo de actualización.
     pthread_join(drawThread, NULL);  // Espera la finalización del hilo de dibujo.
 
+    // Cierra la grabación con el resumen del estado final.
+    ReplayRecorder_close(gameState->recorder, gameState);
+    gameState->recorder = NULL;
+
     // Destruye el mutex al finalizar para liberar recursos.
     pthread_mutex_destroy(&gameStateMutex);
 }
@@ -16,8 +16,6 @@ Consulta el archivo LICENSE para más detalles.
 #include "game_screen.h"
 
 
-static Vector2 brickSize = { 0 };
-
 void init_game_server();
 void unload_game_server();
 void start_game();
@@ -0,0 +1,286 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "jitterBuffer.h"
+#include "commandQueue.h"
+#include "Objects/ball.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NANOS_PER_MS 1000000LL
+
+static JitterEntry *entry(JitterBuffer *buffer, int k) {
+    return &buffer->entries[(buffer->first + k) % JITTER_BUFFER_CAPACITY];
+}
+
+static void drop_oldest(JitterBuffer *buffer) {
+    buffer->first = (buffer->first + 1) % JITTER_BUFFER_CAPACITY;
+    buffer->count--;
+}
+
+// Copia en `gameState` el estado del jugador observado tal como se recibió
+static void copy_state(GameState *gameState, const GameState *received) {
+    gameState->player.position = received->player.position;
+    gameState->player.size = received->player.size;
+    gameState->player.life = received->player.life;
+    gameState->player.score = received->player.score;
+    gameState->levelsCompleted = received->levelsCompleted;
+    gameState->gameOver = received->gameOver;
+    gameState->pause = received->pause;
+    gameState->winner = received->winner;
+    gameState->bolaLanzada = received->bolaLanzada;
+
+    BallPool *balls = &gameState->balls;
+    memcpy(balls->active, received->balls.active, (size_t)balls->words * sizeof(uint64_t));
+    memcpy(balls->x, received->balls.x, (size_t)balls->capacity * sizeof(float));
+    memcpy(balls->y, received->balls.y, (size_t)balls->capacity * sizeof(float));
+
+    BrickGrid *bricks = &gameState->bricks;
+    memcpy(bricks->active, received->bricks.active, (size_t)bricks->rows * bricks->wordsPerRow * sizeof(uint64_t));
+}
+
+// Dos estados consecutivos describen un mismo movimiento si no hubo un silencio largo entre ellos
+static bool continuous(const JitterBuffer *buffer, const JitterEntry *from, const JitterEntry *to) {
+    long long span = to->stamp - from->stamp;
+    long long limit = JITTER_RESYNC_INTERVALS * buffer->interval;
+    return span > 0 && span <= (limit > buffer->delay ? limit : buffer->delay);
+}
+
+static float clampf(float value, float low, float high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+// Copia `discrete` y coloca la raqueta y las bolas en la fracción `t` del camino de `from` a `to`
+// (t > 1 extrapola)
+static void blend(GameState *gameState, const GameState *from, const GameState *to, float t,
+                  const GameState *discrete) {
+    copy_state(gameState, discrete);
+
+    Player *player = &gameState->player;
+    player->position.x = from->player.position.x + (to->player.position.x - from->player.position.x) * t;
+    player->position.y = from->player.position.y + (to->player.position.y - from->player.position.y) * t;
+    player->position.x = clampf(player->position.x, player->size.x / 2, screenWidth - player->size.x / 2);
+
+    BallPool *balls = &gameState->balls;
+    for (int i = 0; i < balls->capacity; i++) {
+        if (!ball_is_active(&from->balls, i) || !ball_is_active(&to->balls, i)) {
+            continue;
+        }
+        float dx = to->balls.x[i] - from->balls.x[i];
+        float dy = to->balls.y[i] - from->balls.y[i];
+        if (dx * dx + dy * dy > JITTER_SNAP_DISTANCE * JITTER_SNAP_DISTANCE) {
+            continue;  // Reaparición o cambio de nivel: la bola salta, no viaja
+        }
+        balls->x[i] = clampf(from->balls.x[i] + dx * t, 0, screenWidth);
+        balls->y[i] = clampf(from->balls.y[i] + dy * t, 0, screenHeight);
+    }
+}
+
+/* Function: JitterBuffer_create
+   Descripción:
+     Crea el buffer vacío y reserva el estado de cada entrada con las dimensiones de `gameState`.
+
+   Params:
+     gameState - Estado del juego ya inicializado (dimensiones del tablero y cantidad de bolas).
+     delayMs - Retraso de reproducción en milisegundos (`network.playoutDelay`).
+
+   Returns:
+     - JitterBuffer*: Buffer listo para usar o `NULL` si no hay memoria.
+
+   Example:
+     gameState->playout = JitterBuffer_create(gameState, DEFAULT_PLAYOUT_DELAY_MS);
+*/
+JitterBuffer *JitterBuffer_create(const GameState *gameState, int delayMs) {
+    JitterBuffer *buffer = calloc(1, sizeof(JitterBuffer));
+    if (buffer == NULL) {
+        return NULL;
+    }
+    buffer->delay = (long long)delayMs * NANOS_PER_MS;
+    for (int k = 0; k < JITTER_BUFFER_CAPACITY; k++) {
+        buffer->entries[k].state = received_state_create(gameState);
+        if (buffer->entries[k].state == NULL) {
+            JitterBuffer_destroy(buffer);
+            return NULL;
+        }
+    }
+    return buffer;
+}
+
+/* Function: JitterBuffer_destroy
+   Descripción:
+     Libera el buffer y los estados de sus entradas.
+
+   Params:
+     buffer - Buffer a liberar; puede ser NULL.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JitterBuffer_destroy(JitterBuffer *buffer) {
+    if (buffer == NULL) {
+        return;
+    }
+    for (int k = 0; k < JITTER_BUFFER_CAPACITY; k++) {
+        received_state_destroy(buffer->entries[k].state);
+    }
+    free(buffer);
+}
+
+/* Function: JitterBuffer_push
+   Descripción:
+     Guarda una copia del estado recibido y le asigna el instante en que debe mostrarse. Con mensajes
+     regulares ese instante es el del mensaje anterior más el intervalo promedio, corregido en 1/JITTER_SMOOTHING
+     hacia la llegada real: un mensaje que llega tarde, o varios que llegan juntos, no cambian el ritmo con
+     el que se muestran. Tras un silencio largo (por ejemplo, con `broadcastMode = "change"` y el juego
+     quieto) la marca vuelve a ser la llegada. Si el buffer está lleno se descarta el estado más antiguo.
+
+   Params:
+     buffer - Buffer del espectador.
+     received - Estado recibido (el de una casilla de la cola de comandos).
+     arrival - Instante de llegada del mensaje (`JitterBuffer_now`).
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Sólo desde la simulación (`apply_game_commands`).
+
+   Problems:
+     - Problema: Si la marca se alejara mucho de la llegada, la reproducción se quedaría sin estados o
+       acumularía retraso.
+       - Solución: La marca nunca se aparta más de medio retraso de la llegada.
+
+   References:
+     - Jacobson, V. et al. RFC 3550, A.8 (estimación del jitter entre llegadas): https://www.rfc-editor.org/rfc/rfc3550
+*/
+void JitterBuffer_push(JitterBuffer *buffer, const GameState *received, long long arrival) {
+    long long stamp = arrival;
+    if (buffer->count > 0) {
+        const JitterEntry *newest = entry(buffer, buffer->count - 1);
+        long long gap = arrival - buffer->lastArrival;
+        if (buffer->interval > 0 && gap <= JITTER_RESYNC_INTERVALS * buffer->interval) {
+            buffer->interval += (gap - buffer->interval) / JITTER_SMOOTHING;
+            long long expected = newest->stamp + buffer->interval;
+            stamp = expected + (arrival - expected) / JITTER_SMOOTHING;
+
+            long long slack = buffer->delay / 2;
+            if (stamp < arrival - slack) stamp = arrival - slack;
+            if (stamp > arrival + slack) stamp = arrival + slack;
+        } else if (buffer->interval == 0 && gap > 0 && gap <= buffer->delay) {
+            buffer->interval = gap;  // Primera estimación del ritmo de los mensajes
+        }
+        if (stamp <= newest->stamp) {
+            stamp = newest->stamp + 1;
+        }
+    }
+    buffer->lastArrival = arrival;
+
+    if (buffer->count == JITTER_BUFFER_CAPACITY) {
+        drop_oldest(buffer);
+    }
+    JitterEntry *slot = entry(buffer, buffer->count++);
+    copy_state(slot->state, received);
+    slot->stamp = stamp;
+}
+
+/* Function: JitterBuffer_sample
+   Descripción:
+     Escribe en `gameState` el estado del instante `now - delay`. Entre dos estados guardados interpola las
+     posiciones de la raqueta y de las bolas (el resto es del estado anterior); después del último estado
+     extrapola con la velocidad entre los dos últimos durante `JITTER_MAX_EXTRAPOLATION_MS` como máximo.
+     Antes del primer estado muestra el primero tal cual. Descarta los estados que ya no se van a usar.
+
+   Params:
+     buffer - Buffer del espectador.
+     gameState - Estado del juego que se dibuja.
+     now - Instante actual (`JitterBuffer_now`).
+
+   Returns:
+     - bool: `false` si todavía no se recibió ningún estado (no se modifica `gameState`).
+
+   Restriction:
+     - Sólo desde la simulación, en cada paso de la pantalla SPECTATOR.
+
+   Example:
+     JitterBuffer_sample(gameState->playout, gameState, JitterBuffer_now());
+
+   Problems:
+     - Problema: Con el estado escrito tal como llegaba, los mensajes amontonados o tardíos se veían como
+       tirones, y enviar menos estados por segundo hacía el movimiento visiblemente escalonado.
+       - Solución: Se dibuja con un retraso fijo y se interpola, así que basta con 15 a 20 estados por segundo.
+     - Problema: Una bola que reaparece sobre la raqueta no debe verse viajando hasta ahí.
+       - Solución: Los saltos mayores que `JITTER_SNAP_DISTANCE` no se interpolan.
+
+   References:
+     - Bernier, Y. Latency Compensating Methods in Client/Server In-game Protocol Design and Optimization:
+       https://developer.valvesoftware.com/wiki/Latency_Compensating_Methods_in_Client/Server_In-game_Protocol_Design_and_Optimization
+     - Fiedler, G. Snapshot Interpolation: https://gafferongames.com/post/snapshot_interpolation/
+*/
+bool JitterBuffer_sample(JitterBuffer *buffer, GameState *gameState, long long now) {
+    if (buffer->count == 0) {
+        return false;
+    }
+    long long target = now - buffer->delay;
+
+    // Basta con el último estado anterior a `target` y los siguientes (dos como mínimo, para extrapolar)
+    while (buffer->count > 2 && entry(buffer, 1)->stamp <= target) {
+        drop_oldest(buffer);
+    }
+
+    const JitterEntry *from = entry(buffer, 0);
+    if (buffer->count == 1 || target <= from->stamp) {
+        copy_state(gameState, from->state);
+        return true;
+    }
+    const JitterEntry *to = entry(buffer, 1);
+    if (!continuous(buffer, from, to)) {
+        copy_state(gameState, (target < to->stamp ? from : to)->state);
+        return true;
+    }
+
+    double span = (double)(to->stamp - from->stamp);
+    double t = (double)(target - from->stamp) / span;
+    if (t < 1.0) {
+        blend(gameState, from->state, to->state, (float)t, from->state);
+    } else {
+        double limit = 1.0 + (double)(JITTER_MAX_EXTRAPOLATION_MS * NANOS_PER_MS) / span;
+        blend(gameState, from->state, to->state, (float)(t < limit ? t : limit), to->state);
+    }
+    return true;
+}
+
+/* Function: JitterBuffer_clear
+   Descripción:
+     Descarta los estados guardados y el ritmo estimado, por ejemplo al empezar a observar a otro jugador.
+
+   Params:
+     buffer - Buffer del espectador.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void JitterBuffer_clear(JitterBuffer *buffer) {
+    buffer->first = 0;
+    buffer->count = 0;
+    buffer->interval = 0;
+    buffer->lastArrival = 0;
+}
+
+// Reloj con el que se marcan las llegadas y se reproduce (CLOCK_MONOTONIC, ns)
+long long JitterBuffer_now() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
@@ -0,0 +1,65 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef JITTER_BUFFER_H
+#define JITTER_BUFFER_H
+
+#include <stdbool.h>
+
+#include "../game_status.h"
+
+/*
+ * Header: Jitter Buffer
+ * Estados recibidos por el espectador, con la hora a la que deben mostrarse, para dibujar el juego con un
+ * retraso fijo (`network.playoutDelay`) en lugar de en el instante en que llega cada mensaje.
+ *
+ *   - Cada estado recibe una marca de tiempo suavizada: el intervalo entre mensajes se promedia, de modo
+ *     que los mensajes que llegan amontonados o tarde quedan repartidos como fueron enviados.
+ *   - En cada paso se muestra el instante `ahora - retraso`: las posiciones de la raqueta y de las bolas
+ *     se interpolan entre los dos estados que lo rodean; el resto (ladrillos, vidas, puntaje) es el del
+ *     estado anterior.
+ *   - Si no llega el estado siguiente, las posiciones se extrapolan con la última velocidad observada
+ *     durante `JITTER_MAX_EXTRAPOLATION_MS` como máximo, y después se quedan quietas.
+ *
+ * Lo escribe y lo lee sólo la simulación (`apply_game_commands` y la pantalla SPECTATOR).
+ */
+
+#define JITTER_BUFFER_CAPACITY 32         // Estados guardados; de sobra para 250 ms a 60 estados/s
+#define JITTER_SMOOTHING 8                // Peso (1/N) de cada mensaje en el promedio de intervalos y en la marca
+#define JITTER_RESYNC_INTERVALS 4         // Un silencio de más intervalos reinicia la marca a la llegada
+#define JITTER_MAX_EXTRAPOLATION_MS 250
+#define JITTER_SNAP_DISTANCE 100.0f       // Una bola que salta más que esto entre estados no se interpola
+#define DEFAULT_PLAYOUT_DELAY_MS 100
+
+typedef struct {
+    GameState *state;   // Estado recibido (ladrillos y bolas propios)
+    long long stamp;    // Instante en que debe mostrarse, antes del retraso (ns)
+} JitterEntry;
+
+typedef struct JitterBuffer {
+    JitterEntry entries[JITTER_BUFFER_CAPACITY];
+    int first;              // Entrada más antigua
+    int count;
+    long long delay;        // Retraso de reproducción (ns)
+    long long interval;     // Promedio del intervalo entre mensajes (ns); 0 si aún no se conoce
+    long long lastArrival;  // Llegada del último mensaje (ns)
+} JitterBuffer;
+
+// Constructor y Destructor
+JitterBuffer *JitterBuffer_create(const GameState *gameState, int delayMs);
+void JitterBuffer_destroy(JitterBuffer *buffer);
+
+// Métodos de la clase
+void JitterBuffer_push(JitterBuffer *buffer, const GameState *received, long long arrival);
+bool JitterBuffer_sample(JitterBuffer *buffer, GameState *gameState, long long now);
+void JitterBuffer_clear(JitterBuffer *buffer);
+long long JitterBuffer_now();
+
+#endif // JITTER_BUFFER_H
@@ -13,6 +13,8 @@ Consulta el archivo LICENSE para más detalles.
 #include "powerHandler.h"
 #include "../game_status.h"
 #include "Objects/player.h"
+#include "Objects/ball.h"
+#include "Objects/brick.h"
 
 GameState *gameStateHandler;
 
@@ -85,13 +87,13 @@ void update_brick_score(int level, int new_points) {
 
     for (int i = 0; i < gameStateHandler->linesOfBricks; i++) {
         for (int j = 0; j < gameStateHandler->bricksPerLine; j++) {
-            if (gameStateHandler->bricks[i][j].active) {
+            if (brick_is_active(&gameStateHandler->bricks, i, j)) {
                 // Calcula el nivel actual para la línea i
                 int current_level = gameStateHandler->linesOfBricks / lines_per_level - i / lines_per_level;
 
                 // Actualiza puntos si la línea pertenece al nivel especificado
                 if (current_level == level) {
-                    gameStateHandler->bricks[i][j].points = new_points;
+                    gameStateHandler->bricks.points[brick_index(&gameStateHandler->bricks, i, j)] = new_points;
                 }
             }
         }
@@ -124,11 +126,13 @@ void update_brick_score(int level, int new_points) {
 */
 
 void add_ball(int posX, int posY) {
-    for (int i = 0; i < gameStateHandler->maxBalls; i++) {
-        if (!gameStateHandler->balls[i].active) {
-            gameStateHandler->balls[i].active = true;
-            gameStateHandler->balls[i].position = (Vector2){ posX, posY };  // Posición del ladrillo destruido
-            gameStateHandler->balls[i].speed = (Vector2){0, 5 * gameStateHandler->ball_speed_multiplier};
+    BallPool *balls = &gameStateHandler->balls;
+    for (int i = 0; i < balls->capacity; i++) {
+        if (!ball_is_active(balls, i)) {
+            // Posición del ladrillo destruido
+            activate_ball(balls, i, (Vector2){ posX, posY },
+                          (Vector2){0, BALL_SPEED * gameStateHandler->ball_speed_multiplier});
+            StateJournal_record(gameStateHandler->journal, JOURNAL_BALL_SPAWN, i, 0);
             break;  // Salir del bucle una vez que activamos una nueva bola
         }
     }
@@ -159,6 +163,7 @@ void add_ball(int posX, int posY) {
 void doubleRacket(){
     if (! (gameStateHandler->player.size.x >= 4*(screenWidth/10))) {
         gameStateHandler->player.size = (Vector2){ gameStateHandler->player.size.x*2, 10 };
+        StateJournal_record(gameStateHandler->journal, JOURNAL_PADDLE_RESIZE, 0, 0);
     }
 }
 
@@ -187,6 +192,7 @@ void doubleRacket(){
 void halfRacket(){
     if (!(gameStateHandler->player.size.x <= screenWidth/(10*4))){
         gameStateHandler->player.size = (Vector2){ gameStateHandler->player.size.x/2, 10 };
+        StateJournal_record(gameStateHandler->journal, JOURNAL_PADDLE_RESIZE, 0, 0);
     }
 }
 
@@ -215,6 +221,7 @@ void halfRacket(){
 void addLife() {
     if (gameStateHandler->player.life < gameStateHandler->playerMaxLife ) {
         gameStateHandler->player.life ++;
+        StateJournal_record(gameStateHandler->journal, JOURNAL_LIFE, gameStateHandler->player.life, 0);
     }
 }
 
@@ -240,10 +247,11 @@ void addLife() {
      - Problema: Si alguna bola tiene una velocidad nula, seguirá inactiva a pesar de la operación.
 */
 void speedUp(){
-    for (int i = 0; i < gameStateHandler->maxBalls; i++) {
-        if (gameStateHandler->balls[i].active) {
-            gameStateHandler->balls[i].speed.y *= 2;
-            gameStateHandler->balls[i].speed.x *= 2;
+    BallPool *balls = &gameStateHandler->balls;
+    for (int i = 0; i < balls->capacity; i++) {
+        if (ball_is_active(balls, i)) {
+            balls->speedY[i] *= 2;
+            balls->speedX[i] *= 2;
         }
     }
 }
@@ -270,10 +278,11 @@ Problems:
 - Problema: Si alguna bola tiene una velocidad muy baja, podría hacerse imperceptible o no funcional.
 */
 void speedDown(){
-    for (int i = 0; i < gameStateHandler->maxBalls; i++) {
-        if (gameStateHandler->balls[i].active) {
-            gameStateHandler->balls[i].speed.y /= 2;
-            gameStateHandler->balls[i].speed.x /= 2;
+    BallPool *balls = &gameStateHandler->balls;
+    for (int i = 0; i < balls->capacity; i++) {
+        if (ball_is_active(balls, i)) {
+            balls->speedY[i] /= 2;
+            balls->speedX[i] /= 2;
         }
     }
 }
@@ -300,7 +309,7 @@ void speedDown(){
 */
 
 void update_brick_ball(int i, int j){
-    gameStateHandler->bricks[i][j].power = ADD_BALL;
+    gameStateHandler->bricks.power[brick_index(&gameStateHandler->bricks, i, j)] = ADD_BALL;
 }
 
 /* Function: update_brick_life
@@ -323,7 +332,7 @@ void update_brick_ball(int i, int j){
      // Asigna el poder `ADD_LIFE` al ladrillo en la fila 1, columna 4.
 */
 void update_brick_life(int i, int j){
-    gameStateHandler->bricks[i][j].power = ADD_LIFE;
+    gameStateHandler->bricks.power[brick_index(&gameStateHandler->bricks, i, j)] = ADD_LIFE;
 }
 
 /* Function: update_brick_doubleRacket
@@ -346,7 +355,7 @@ void update_brick_life(int i, int j){
      // Asigna el poder `DOUBLE_RACKET` al ladrillo en la fila 0, columna 2.
 */
 void update_brick_doubleRacket(int i, int j){
-    gameStateHandler->bricks[i][j].power = DOUBLE_RACKET;
+    gameStateHandler->bricks.power[brick_index(&gameStateHandler->bricks, i, j)] = DOUBLE_RACKET;
 }
 
 /* Function: update_brick_halfRacket
@@ -369,7 +378,7 @@ void update_brick_doubleRacket(int i, int j){
      // Asigna el poder `HALF_RACKET` al ladrillo en la fila 3, columna 5.
 */
 void update_brick_halfRacket(int i, int j){
-    gameStateHandler->bricks[i][j].power = HALF_RACKET;
+    gameStateHandler->bricks.power[brick_index(&gameStateHandler->bricks, i, j)] = HALF_RACKET;
 }
 
 /* Function: update_brick_speedUp
@@ -393,7 +402,7 @@ void update_brick_halfRacket(int i, int j){
 */
 
 void update_brick_speedUp(int i, int j){
-    gameStateHandler->bricks[i][j].power = SPEED_UP;
+    gameStateHandler->bricks.power[brick_index(&gameStateHandler->bricks, i, j)] = SPEED_UP;
 }
 
 /* Function: update_brick_speedDown
@@ -416,7 +425,7 @@ void update_brick_speedUp(int i, int j){
      // Asigna el poder `SPEED_DOWN` al ladrillo en la fila 1, columna 3.
 */
 void update_brick_speedDown(int i, int j){
-    gameStateHandler->bricks[i][j].power = SPEED_DOWN;
+    gameStateHandler->bricks.power[brick_index(&gameStateHandler->bricks, i, j)] = SPEED_DOWN;
 }
 
 /* Function: update_player_score
@@ -439,7 +448,9 @@ update_player_score(0, 2);
 */
 
 void update_player_score(int brickx, int bricky) {
-    updatePlayerScore(&gameStateHandler->player, gameStateHandler->bricks[brickx][bricky].points);
+    int index = brick_index(&gameStateHandler->bricks, brickx, bricky);
+    updatePlayerScore(&gameStateHandler->player, gameStateHandler->bricks.points[index]);
+    StateJournal_record(gameStateHandler->journal, JOURNAL_SCORE, gameStateHandler->player.score, 0);
 }
 
 /* Function: check_brick
@@ -474,18 +485,21 @@ References:
 */
 
 void check_brick(int i, int j){
-    if (gameStateHandler->bricks[i][j].power == ADD_BALL) {
-        add_ball(gameStateHandler->bricks[i][j].position.x, gameStateHandler->bricks[i][j].position.y);
-    } else if (gameStateHandler->bricks[i][j].power == DOUBLE_RACKET) {
+    int index = brick_index(&gameStateHandler->bricks, i, j);
+    PowerType power = gameStateHandler->bricks.power[index];
+    if (power == ADD_BALL) {
+        Vector2 position = gameStateHandler->bricks.position[index];
+        add_ball(position.x, position.y);
+    } else if (power == DOUBLE_RACKET) {
         doubleRacket();
     }
-    else if (gameStateHandler->bricks[i][j].power == ADD_LIFE) {
+    else if (power == ADD_LIFE) {
         addLife();
-    } else if (gameStateHandler->bricks[i][j].power == HALF_RACKET) {
+    } else if (power == HALF_RACKET) {
         halfRacket();
-    } else if (gameStateHandler->bricks[i][j].power == SPEED_UP) {
+    } else if (power == SPEED_UP) {
         speedUp();
-    } else if (gameStateHandler->bricks[i][j].power == SPEED_DOWN) {
+    } else if (power == SPEED_DOWN) {
         speedDown();
     }
 }
\ No newline at end of file
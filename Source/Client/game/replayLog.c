@@ -0,0 +1,428 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "replayLog.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+
+#define REPLAY_MAGIC "BKRP"
+#define REPLAY_FILE_BUFFER (64 * 1024)
+
+#define INPUT_MOVE_LEFT    0x01
+#define INPUT_MOVE_RIGHT   0x02
+#define INPUT_LAUNCH       0x04
+#define INPUT_TOGGLE_PAUSE 0x08
+#define INPUT_CONFIRM      0x10
+
+// ============================================================================================================= //
+// CODIFICACIÓN
+
+static void putU8(FILE *file, uint8_t value) {
+    fputc(value, file);
+}
+
+static void putU16(FILE *file, uint16_t value) {
+    fputc(value & 0xFF, file);
+    fputc(value >> 8, file);
+}
+
+static void putU32(FILE *file, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) fputc((value >> shift) & 0xFF, file);
+}
+
+static void putU64(FILE *file, uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) fputc((value >> shift) & 0xFF, file);
+}
+
+// Entero sin signo en base 128: 7 bits por byte, el bit alto indica que sigue otro byte
+static void putVarint(FILE *file, uint64_t value) {
+    while (value >= 0x80) {
+        fputc((int)(value & 0x7F) | 0x80, file);
+        value >>= 7;
+    }
+    fputc((int)value, file);
+}
+
+static bool getU8(FILE *file, uint8_t *value) {
+    int c = fgetc(file);
+    if (c == EOF) return false;
+    *value = (uint8_t)c;
+    return true;
+}
+
+static bool getU16(FILE *file, uint16_t *value) {
+    uint8_t lo, hi;
+    if (!getU8(file, &lo) || !getU8(file, &hi)) return false;
+    *value = (uint16_t)(lo | (hi << 8));
+    return true;
+}
+
+static bool getU32(FILE *file, uint32_t *value) {
+    *value = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint8_t byte;
+        if (!getU8(file, &byte)) return false;
+        *value |= (uint32_t)byte << shift;
+    }
+    return true;
+}
+
+static bool getU64(FILE *file, uint64_t *value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 8) {
+        uint8_t byte;
+        if (!getU8(file, &byte)) return false;
+        *value |= (uint64_t)byte << shift;
+    }
+    return true;
+}
+
+static bool getVarint(FILE *file, uint64_t *value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte;
+        if (!getU8(file, &byte)) return false;
+        *value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+static uint8_t input_bits(const TickInput *input) {
+    return (input->moveLeft ? INPUT_MOVE_LEFT : 0)
+         | (input->moveRight ? INPUT_MOVE_RIGHT : 0)
+         | (input->launch ? INPUT_LAUNCH : 0)
+         | (input->togglePause ? INPUT_TOGGLE_PAUSE : 0)
+         | (input->confirm ? INPUT_CONFIRM : 0);
+}
+
+static void input_from_bits(uint8_t bits, TickInput *input) {
+    input->moveLeft = (bits & INPUT_MOVE_LEFT) != 0;
+    input->moveRight = (bits & INPUT_MOVE_RIGHT) != 0;
+    input->launch = (bits & INPUT_LAUNCH) != 0;
+    input->togglePause = (bits & INPUT_TOGGLE_PAUSE) != 0;
+    input->confirm = (bits & INPUT_CONFIRM) != 0;
+}
+
+// Tipo y pasos desde el registro anterior
+static void put_record(ReplayRecorder *recorder, ReplayRecordType type) {
+    putU8(recorder->file, (uint8_t)type);
+    putVarint(recorder->file, (uint64_t)(recorder->tick - recorder->lastTick));
+    recorder->lastTick = recorder->tick;
+}
+
+// FNV-1a de 64 bits
+static uint64_t hash_bytes(uint64_t hash, const void *data, size_t length) {
+    const uint8_t *bytes = data;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/* Function: replay_state_hash
+   Descripción:
+     Resume en 64 bits lo que define el resultado de la simulación: jugador, puntaje, nivel, bolas y
+     ladrillos activos. Dos ejecuciones con la misma grabación deben dar el mismo valor; si un cambio en la
+     física lo altera, la repetición lo reporta.
+
+   Params:
+     gameState - Estado del juego.
+
+   Returns:
+     - uint64_t: Hash FNV-1a del estado.
+
+   References:
+     - FNV hash: http://www.isthe.com/chongo/tech/comp/fnv/
+*/
+uint64_t replay_state_hash(const GameState *gameState) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = hash_bytes(hash, &gameState->player.position, sizeof(Vector2));
+    hash = hash_bytes(hash, &gameState->player.size, sizeof(Vector2));
+    hash = hash_bytes(hash, &gameState->player.life, sizeof(int));
+    hash = hash_bytes(hash, &gameState->player.score, sizeof(int));
+    hash = hash_bytes(hash, &gameState->levelsCompleted, sizeof(int));
+
+    const BallPool *balls = &gameState->balls;
+    hash = hash_bytes(hash, balls->active, (size_t)balls->words * sizeof(uint64_t));
+    hash = hash_bytes(hash, balls->x, (size_t)balls->capacity * sizeof(float));
+    hash = hash_bytes(hash, balls->y, (size_t)balls->capacity * sizeof(float));
+
+    const BrickGrid *bricks = &gameState->bricks;
+    return hash_bytes(hash, bricks->active, (size_t)bricks->rows * bricks->wordsPerRow * sizeof(uint64_t));
+}
+
+// ============================================================================================================= //
+// GRABACIÓN
+
+/* Function: ReplayRecorder_open
+   Descripción:
+     Crea el archivo de la grabación y escribe el encabezado con la configuración que determina la
+     simulación (paso, tablero, bolas y vidas).
+
+   Params:
+     path - Ruta del archivo; se reemplaza si existe.
+     gameState - Estado del juego ya inicializado.
+
+   Returns:
+     - ReplayRecorder*: Grabación abierta o `NULL` si no se pudo crear el archivo.
+
+   Example:
+     gameState->recorder = ReplayRecorder_open("partida.bkrp", gameState);
+*/
+ReplayRecorder *ReplayRecorder_open(const char *path, const GameState *gameState) {
+    ReplayRecorder *recorder = calloc(1, sizeof(ReplayRecorder));
+    if (recorder == NULL) {
+        return NULL;
+    }
+    recorder->file = fopen(path, "wb");
+    if (recorder->file == NULL) {
+        free(recorder);
+        return NULL;
+    }
+    setvbuf(recorder->file, NULL, _IOFBF, REPLAY_FILE_BUFFER);
+
+    fwrite(REPLAY_MAGIC, 1, 4, recorder->file);
+    putU8(recorder->file, REPLAY_VERSION);
+    putU16(recorder->file, (uint16_t)gameState->tickRate);
+    putU16(recorder->file, (uint16_t)gameState->linesOfBricks);
+    putU16(recorder->file, (uint16_t)gameState->bricksPerLine);
+    putU16(recorder->file, (uint16_t)gameState->maxBalls);
+    putU16(recorder->file, (uint16_t)gameState->playerMaxLife);
+    return recorder;
+}
+
+/* Function: ReplayRecorder_close
+   Descripción:
+     Escribe el resumen del estado final y cierra el archivo.
+
+   Params:
+     recorder - Grabación abierta; puede ser NULL.
+     gameState - Estado del juego al terminar.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Con la simulación detenida.
+*/
+void ReplayRecorder_close(ReplayRecorder *recorder, const GameState *gameState) {
+    if (recorder == NULL) {
+        return;
+    }
+    put_record(recorder, REPLAY_RECORD_END);
+    putU32(recorder->file, (uint32_t)gameState->player.score);
+    putU8(recorder->file, (uint8_t)gameState->player.life);
+    putU16(recorder->file, (uint16_t)gameState->levelsCompleted);
+    putU64(recorder->file, replay_state_hash(gameState));
+    fclose(recorder->file);
+    free(recorder);
+}
+
+/* Function: ReplayRecorder_input
+   Descripción:
+     Graba la entrada del paso que se va a simular (sólo si cambió respecto al paso anterior) y avanza
+     el contador de pasos.
+
+   Params:
+     recorder - Grabación abierta.
+     input - Entrada que recibe `update_game` en este paso.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Una vez por paso, desde la simulación (`simulate_tick`).
+*/
+void ReplayRecorder_input(ReplayRecorder *recorder, const TickInput *input) {
+    uint8_t bits = input_bits(input);
+    if (bits != recorder->lastInput) {
+        put_record(recorder, REPLAY_RECORD_INPUT);
+        putU8(recorder->file, bits);
+        recorder->lastInput = bits;
+    }
+    recorder->tick++;
+}
+
+/* Function: ReplayRecorder_brick
+   Descripción:
+     Graba un poder recibido por la red en el momento en que la simulación lo aplica.
+
+   Params:
+     recorder - Grabación abierta.
+     row, column, power - Comando tal como lo aplica `apply_game_commands`.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void ReplayRecorder_brick(ReplayRecorder *recorder, int row, int column, PowerType power) {
+    put_record(recorder, REPLAY_RECORD_BRICK);
+    putU16(recorder->file, (uint16_t)(int16_t)row);
+    putU16(recorder->file, (uint16_t)(int16_t)column);
+    putU8(recorder->file, (uint8_t)power);
+}
+
+/* Function: ReplayRecorder_reset
+   Descripción:
+     Graba el inicio de una partida nueva (`start_match`).
+
+   Params:
+     recorder - Grabación abierta.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void ReplayRecorder_reset(ReplayRecorder *recorder) {
+    put_record(recorder, REPLAY_RECORD_RESET);
+}
+
+// ============================================================================================================= //
+// REPETICIÓN
+
+/* Function: ReplayPlayer_open
+   Descripción:
+     Abre una grabación y lee su encabezado.
+
+   Params:
+     path - Ruta del archivo.
+
+   Returns:
+     - ReplayPlayer*: Lector listo o `NULL` si el archivo no existe o no es una grabación de esta versión.
+*/
+ReplayPlayer *ReplayPlayer_open(const char *path) {
+    ReplayPlayer *player = calloc(1, sizeof(ReplayPlayer));
+    if (player == NULL) {
+        return NULL;
+    }
+    player->file = fopen(path, "rb");
+    if (player->file == NULL) {
+        free(player);
+        return NULL;
+    }
+    setvbuf(player->file, NULL, _IOFBF, REPLAY_FILE_BUFFER);
+
+    char magic[4];
+    uint8_t version;
+    uint16_t tickRate, rows, cols, maxBalls, playerMaxLife;
+    if (fread(magic, 1, 4, player->file) != 4 || memcmp(magic, REPLAY_MAGIC, 4) != 0
+        || !getU8(player->file, &version) || version != REPLAY_VERSION
+        || !getU16(player->file, &tickRate) || !getU16(player->file, &rows) || !getU16(player->file, &cols)
+        || !getU16(player->file, &maxBalls) || !getU16(player->file, &playerMaxLife)) {
+        ReplayPlayer_close(player);
+        return NULL;
+    }
+    player->header = (ReplayHeader){ tickRate, rows, cols, maxBalls, playerMaxLife };
+    return player;
+}
+
+/* Function: ReplayPlayer_close
+   Descripción:
+     Cierra la grabación.
+
+   Params:
+     player - Grabación abierta; puede ser NULL.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void ReplayPlayer_close(ReplayPlayer *player) {
+    if (player == NULL) {
+        return;
+    }
+    fclose(player->file);
+    free(player);
+}
+
+/* Function: ReplayPlayer_matches
+   Descripción:
+     Indica si la configuración actual es la misma con la que se grabó. Con otra configuración la
+     repetición no reproduciría la partida.
+
+   Params:
+     player - Grabación abierta.
+     gameState - Estado del juego inicializado con la configuración actual.
+
+   Returns:
+     - bool: `true` si coinciden el paso, el tablero, las bolas y las vidas.
+*/
+bool ReplayPlayer_matches(const ReplayPlayer *player, const GameState *gameState) {
+    const ReplayHeader *header = &player->header;
+    return header->tickRate == gameState->tickRate
+        && header->rows == gameState->linesOfBricks
+        && header->cols == gameState->bricksPerLine
+        && header->maxBalls == gameState->maxBalls
+        && header->playerMaxLife == gameState->playerMaxLife;
+}
+
+/* Function: ReplayPlayer_read
+   Descripción:
+     Lee el siguiente registro de la grabación.
+
+   Params:
+     player - Grabación abierta.
+     record - Recibe el registro; `record->tick` es el paso antes del cual se aplica.
+
+   Returns:
+     - bool: `false` al llegar al final del archivo o si el registro está incompleto.
+
+   Example:
+     ReplayRecord record;
+     while (ReplayPlayer_read(player, &record) && record.type != REPLAY_RECORD_END) { ... }
+*/
+bool ReplayPlayer_read(ReplayPlayer *player, ReplayRecord *record) {
+    uint8_t type;
+    uint64_t delta;
+    if (!getU8(player->file, &type) || !getVarint(player->file, &delta)) {
+        return false;
+    }
+    player->tick += (long long)delta;
+    memset(record, 0, sizeof(*record));
+    record->type = (ReplayRecordType)type;
+    record->tick = player->tick;
+
+    switch (record->type) {
+        case REPLAY_RECORD_INPUT: {
+            uint8_t bits;
+            if (!getU8(player->file, &bits)) return false;
+            input_from_bits(bits, &record->input);
+            return true;
+        }
+        case REPLAY_RECORD_BRICK: {
+            uint16_t row, column;
+            uint8_t power;
+            if (!getU16(player->file, &row) || !getU16(player->file, &column) || !getU8(player->file, &power)) {
+                return false;
+            }
+            record->row = (int16_t)row;
+            record->column = (int16_t)column;
+            record->power = (PowerType)power;
+            return true;
+        }
+        case REPLAY_RECORD_RESET:
+            return true;
+        case REPLAY_RECORD_END: {
+            uint32_t score;
+            uint8_t lives;
+            uint16_t levels;
+            uint64_t hash;
+            if (!getU32(player->file, &score) || !getU8(player->file, &lives) || !getU16(player->file, &levels)
+                || !getU64(player->file, &hash)) {
+                return false;
+            }
+            record->summary = (ReplaySummary){ record->tick, (int32_t)score, lives, levels, hash };
+            return true;
+        }
+    }
+    return false;  // Tipo desconocido
+}
@@ -0,0 +1,104 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef REPLAY_LOG_H
+#define REPLAY_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../game_status.h"
+#include "tickInput.h"
+
+/*
+ * Header: Replay Log
+ * Grabación binaria de una sesión para repetirla paso a paso. La simulación es determinista dados la
+ * configuración, la entrada de cada paso y los comandos de la red aplicados antes de cada paso, así que
+ * eso es todo lo que se graba.
+ *
+ * Formato (enteros en little-endian):
+ *   Encabezado: "BKRP", versión (u8), tickRate, filas, columnas, maxBalls, playerMaxLife (u16 cada uno).
+ *   Registros:  tipo (u8), pasos desde el registro anterior (varint), datos del tipo:
+ *     - REPLAY_RECORD_INPUT: bits de `TickInput` (u8). Sólo se graba cuando la entrada cambia.
+ *     - REPLAY_RECORD_BRICK: fila y columna (i16), poder (u8). Se aplica antes del paso indicado.
+ *     - REPLAY_RECORD_RESET: partida nueva (`start_match`).
+ *     - REPLAY_RECORD_END: resumen del estado final (`ReplaySummary`) para comparar al repetir.
+ *
+ * Typedefs:
+ *   - ReplayRecorder: Escritor de la grabación; lo usa sólo la simulación.
+ *   - ReplayPlayer: Lector de la grabación, registro por registro.
+ */
+
+#define REPLAY_VERSION 1
+
+typedef enum {
+    REPLAY_RECORD_INPUT = 1,
+    REPLAY_RECORD_BRICK = 2,
+    REPLAY_RECORD_RESET = 3,
+    REPLAY_RECORD_END = 4
+} ReplayRecordType;
+
+// Estado al terminar la grabación
+typedef struct {
+    long long ticks;
+    int score;
+    int lives;
+    int levelsCompleted;
+    uint64_t hash;  // replay_state_hash del estado final
+} ReplaySummary;
+
+typedef struct {
+    ReplayRecordType type;
+    long long tick;         // Paso antes del cual se aplica el registro
+    TickInput input;        // REPLAY_RECORD_INPUT
+    int row;                // REPLAY_RECORD_BRICK
+    int column;
+    PowerType power;
+    ReplaySummary summary;  // REPLAY_RECORD_END
+} ReplayRecord;
+
+typedef struct {
+    int tickRate;
+    int rows;
+    int cols;
+    int maxBalls;
+    int playerMaxLife;
+} ReplayHeader;
+
+typedef struct ReplayRecorder {
+    FILE *file;
+    long long tick;          // Pasos grabados
+    long long lastTick;      // Paso del último registro escrito
+    uint8_t lastInput;       // Bits de la última entrada grabada
+} ReplayRecorder;
+
+typedef struct {
+    FILE *file;
+    ReplayHeader header;
+    long long tick;          // Paso del último registro leído
+} ReplayPlayer;
+
+// Constructor y Destructor
+ReplayRecorder *ReplayRecorder_open(const char *path, const GameState *gameState);
+void ReplayRecorder_close(ReplayRecorder *recorder, const GameState *gameState);
+ReplayPlayer *ReplayPlayer_open(const char *path);
+void ReplayPlayer_close(ReplayPlayer *player);
+
+// Métodos de la clase
+void ReplayRecorder_input(ReplayRecorder *recorder, const TickInput *input);
+void ReplayRecorder_brick(ReplayRecorder *recorder, int row, int column, PowerType power);
+void ReplayRecorder_reset(ReplayRecorder *recorder);
+bool ReplayPlayer_matches(const ReplayPlayer *player, const GameState *gameState);
+bool ReplayPlayer_read(ReplayPlayer *player, ReplayRecord *record);
+
+uint64_t replay_state_hash(const GameState *gameState);
+
+#endif // REPLAY_LOG_H
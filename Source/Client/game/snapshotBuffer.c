@@ -0,0 +1,264 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "snapshotBuffer.h"
+#include "ballKernel.h"
+#include "Objects/brick.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+
+
+// Copia el estado conservando los arreglos propios de la copia
+static void snapshot_capture(GameSnapshot *snapshot, const GameState *gameState) {
+    BrickGrid bricks = snapshot->state.bricks;
+    BallPool balls = snapshot->state.balls;
+
+    snapshot->state = *gameState;
+    snapshot->state.bricks = bricks;
+    snapshot->state.balls = balls;
+    snapshot->state.journal = NULL;  // La bitácora viva es de la simulación
+
+    brick_grid_copy(&snapshot->state.bricks, &gameState->bricks);
+    ball_pool_copy(&snapshot->state.balls, &gameState->balls);
+}
+
+static void journal_copy(StateJournal *out, const StateJournal *journal) {
+    out->count = journal->count;
+    out->dirty = journal->dirty;
+    out->fullSync = journal->fullSync;
+    memcpy(out->events, journal->events, (size_t)journal->count * sizeof(JournalEvent));
+}
+
+/* Function: SnapshotBuffer_create
+   Descripción:
+     Crea el triple buffer con los arreglos de ladrillos y bolas de cada copia, y copia `gameState` en
+     las tres para que el lector tenga un estado válido antes de la primera publicación.
+
+   Params:
+     gameState - Estado del juego ya inicializado (dimensiones del tablero y cantidad de bolas).
+     notify - `true` si el lector va a esperar las publicaciones con `SnapshotBuffer_wait`.
+
+   Returns:
+     - SnapshotBuffer*: Buffer listo para usar o `NULL` si no hay memoria o no se pudo crear el eventfd.
+
+   Example:
+     gameState->renderSnapshots = SnapshotBuffer_create(gameState, false);
+*/
+SnapshotBuffer *SnapshotBuffer_create(const GameState *gameState, bool notify) {
+    SnapshotBuffer *buffer = calloc(1, sizeof(SnapshotBuffer));
+    if (buffer == NULL) {
+        return NULL;
+    }
+
+    buffer->wakeFd = notify ? eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC) : -1;
+    if (notify && buffer->wakeFd < 0) {
+        free(buffer);
+        return NULL;
+    }
+
+    for (int k = 0; k < SNAPSHOT_BUFFER_COUNT; k++) {
+        GameSnapshot *snapshot = &buffer->snapshots[k];
+        if (!brick_grid_alloc(&snapshot->state.bricks, gameState->bricks.rows, gameState->bricks.cols)
+            || !ball_pool_alloc(&snapshot->state.balls, gameState->balls.capacity)) {
+            SnapshotBuffer_destroy(buffer);
+            return NULL;
+        }
+        snapshot_capture(snapshot, gameState);
+        StateJournal_clear(&snapshot->journal);
+    }
+    StateJournal_clear(&buffer->unseen);
+
+    buffer->reading = 0;
+    buffer->writing = 2;
+    buffer->lastPublished = 1;
+    atomic_init(&buffer->latest, 1);
+    return buffer;
+}
+
+/* Function: SnapshotBuffer_destroy
+   Descripción:
+     Libera el buffer y los arreglos de sus copias.
+
+   Params:
+     buffer - Buffer a liberar; puede ser NULL.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Ni la simulación ni el lector pueden estar usándolo.
+*/
+void SnapshotBuffer_destroy(SnapshotBuffer *buffer) {
+    if (buffer == NULL) {
+        return;
+    }
+    for (int k = 0; k < SNAPSHOT_BUFFER_COUNT; k++) {
+        brick_grid_free(&buffer->snapshots[k].state.bricks);
+        ball_pool_free(&buffer->snapshots[k].state.balls);
+    }
+    if (buffer->wakeFd >= 0) {
+        close(buffer->wakeFd);
+    }
+    free(buffer);
+}
+
+/* Function: SnapshotBuffer_publish
+   Descripción:
+     Copia el estado del paso en el buffer del productor y lo publica como la copia más reciente. El buffer
+     que se reemplaza pasa a ser el siguiente buffer del productor; si el lector no lo había tomado, esa copia
+     simplemente se descarta.
+
+     Los cambios de `changes` se acumulan en `unseen` y viajan completos en cada copia hasta que el lector
+     toma una: así el envío del estado no pierde ladrillos destruidos aunque se salte copias.
+
+     Si el buffer avisa al lector, escribe en el eventfd sólo cuando el lector ya había tomado la copia
+     anterior; mientras tenga una pendiente, ya tiene un aviso sin atender.
+
+   Params:
+     buffer - Buffer del lector.
+     gameState - Estado del juego después del paso.
+     changes - Bitácora de la simulación, que se vacía; `NULL` si el lector no usa los cambios.
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Sólo la simulación publica, con `gameStateMutex` tomado si otros hilos escriben el estado.
+
+   Example:
+     SnapshotBuffer_publish(gameState->networkSnapshots, gameState, gameState->journal);
+
+   Problems:
+     - Problema: El lector puede tomar la copia anterior justo después de que se revisa `latest`.
+       - Solución: Entonces la copia nueva repite cambios que el lector ya vio. `StateEncoder_encode` los
+         aplica sin efecto (un ladrillo sólo se destruye una vez), así que no hace falta un candado.
+
+   References:
+     - C11 atomic_exchange: https://en.cppreference.com/w/c/atomic/atomic_exchange
+*/
+void SnapshotBuffer_publish(SnapshotBuffer *buffer, const GameState *gameState, StateJournal *changes) {
+    // Sólo el productor pone SNAPSHOT_FRESH: si no está, el lector ya tomó la copia anterior y sus cambios
+    if (!(atomic_load_explicit(&buffer->latest, memory_order_acquire) & SNAPSHOT_FRESH)) {
+        StateJournal_clear(&buffer->unseen);
+    }
+    if (changes != NULL) {
+        StateJournal_append(changes, &buffer->unseen);
+    }
+
+    GameSnapshot *snapshot = &buffer->snapshots[buffer->writing];
+    snapshot_capture(snapshot, gameState);
+    journal_copy(&snapshot->journal, &buffer->unseen);
+    snapshot->sequence = ++buffer->published;
+
+    unsigned previous = atomic_exchange_explicit(&buffer->latest, buffer->writing | SNAPSHOT_FRESH,
+                                                 memory_order_acq_rel);
+    buffer->lastPublished = buffer->writing;
+    buffer->writing = previous & ~SNAPSHOT_FRESH;
+
+    if (buffer->wakeFd >= 0 && !(previous & SNAPSHOT_FRESH)) {
+        uint64_t one = 1;
+        ssize_t ignored = write(buffer->wakeFd, &one, sizeof(one));
+        (void)ignored;
+    }
+}
+
+/* Function: SnapshotBuffer_read
+   Descripción:
+     Devuelve la copia más reciente. Si hay una publicación nueva la intercambia por la que el lector tenía;
+     si no, devuelve la misma copia de la llamada anterior. No bloquea ni espera a la simulación.
+
+   Params:
+     buffer - Buffer del lector.
+     isNew - Salida opcional: `true` si la copia es distinta de la devuelta en la llamada anterior.
+
+   Returns:
+     - const GameSnapshot*: Copia válida hasta la próxima llamada desde el mismo hilo.
+
+   Restriction:
+     - Un solo hilo lector por buffer.
+
+   Example:
+     bool isNew;
+     const GameSnapshot *snapshot = SnapshotBuffer_read(gameState->renderSnapshots, &isNew);
+     draw_game_state(&snapshot->state);
+*/
+const GameSnapshot *SnapshotBuffer_read(SnapshotBuffer *buffer, bool *isNew) {
+    // Sólo el lector quita SNAPSHOT_FRESH, así que no puede desaparecer entre la lectura y el intercambio
+    bool fresh = (atomic_load_explicit(&buffer->latest, memory_order_relaxed) & SNAPSHOT_FRESH) != 0;
+    if (fresh) {
+        unsigned previous = atomic_exchange_explicit(&buffer->latest, buffer->reading, memory_order_acq_rel);
+        buffer->reading = previous & ~SNAPSHOT_FRESH;
+    }
+    if (isNew != NULL) {
+        *isNew = fresh;
+    }
+    return &buffer->snapshots[buffer->reading];
+}
+
+/* Function: SnapshotBuffer_wait
+   Descripción:
+     Duerme hasta que la simulación publique una copia que el lector no ha tomado, o hasta `timeoutMs`.
+     Después hay que tomarla con `SnapshotBuffer_read`.
+
+   Params:
+     buffer - Buffer creado con `notify`.
+     timeoutMs - Espera máxima en milisegundos, para que el lector pueda revisar si debe terminar.
+
+   Returns:
+     - bool: `true` si hubo una publicación; `false` si se venció el tiempo.
+
+   Restriction:
+     - Sólo el hilo lector del buffer.
+
+   Example:
+     if (SnapshotBuffer_wait(gameState->networkSnapshots, 100)) {
+         const GameSnapshot *snapshot = SnapshotBuffer_read(gameState->networkSnapshots, NULL);
+     }
+
+   References:
+     - eventfd: https://man7.org/linux/man-pages/man2/eventfd.2.html
+     - poll: https://man7.org/linux/man-pages/man2/poll.2.html
+*/
+bool SnapshotBuffer_wait(SnapshotBuffer *buffer, int timeoutMs) {
+    struct pollfd wake = { .fd = buffer->wakeFd, .events = POLLIN };
+    if (poll(&wake, 1, timeoutMs) <= 0) {
+        return false;
+    }
+    uint64_t value;
+    ssize_t ignored = read(buffer->wakeFd, &value, sizeof(value));
+    (void)ignored;
+    return true;
+}
+
+/* Function: SnapshotBuffer_lastPublished
+   Descripción:
+     Devuelve la última copia que publicó la simulación, para comparar el estado actual contra ella. El
+     productor nunca escribe esa copia (la siguiente publicación usa otro buffer), así que leerla es seguro
+     aunque el lector la esté leyendo al mismo tiempo.
+
+   Params:
+     buffer - Buffer del lector.
+
+   Returns:
+     - const GameSnapshot*: Última copia publicada (la inicial si todavía no se publica ninguna).
+
+   Restriction:
+     - Sólo el productor (la simulación).
+*/
+const GameSnapshot *SnapshotBuffer_lastPublished(const SnapshotBuffer *buffer) {
+    return &buffer->snapshots[buffer->lastPublished];
+}
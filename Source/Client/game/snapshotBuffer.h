@@ -0,0 +1,74 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef SNAPSHOT_BUFFER_H
+#define SNAPSHOT_BUFFER_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../game_status.h"
+#include "stateJournal.h"
+
+/*
+ * Header: Snapshot Buffer
+ * Triple buffer de copias del estado del juego entre la simulación (productor) y un hilo lector
+ * (consumidor): el dibujo o el envío del estado.
+ *
+ *   - La simulación copia el estado en el buffer que es suyo y lo publica con un solo intercambio
+ *     atómico del índice `latest`; nunca espera al lector.
+ *   - El lector toma la última copia publicada con otro intercambio y la lee sin locks mientras quiera:
+ *     la simulación no vuelve a escribir ese buffer hasta que el lector tome uno nuevo.
+ *   - Cada copia lleva también los cambios de la bitácora que el lector todavía no vio, aunque se
+ *     haya saltado copias intermedias (ver `SnapshotBuffer_publish`).
+ *
+ * Hay un `SnapshotBuffer` por lector (`GameState.renderSnapshots` y `GameState.networkSnapshots`).
+ * Un buffer creado con `notify` tiene además un eventfd con el que el lector puede dormir hasta la
+ * siguiente publicación (`SnapshotBuffer_wait`) en lugar de consultar con un temporizador propio.
+ */
+
+#define SNAPSHOT_BUFFER_COUNT 3
+#define SNAPSHOT_FRESH 0x4u  // Bit de `latest`: la copia publicada aún no la toma el lector
+
+// Copia del estado de un paso. Los ladrillos y las bolas son arreglos propios de la copia.
+typedef struct {
+    GameState state;        // `state.journal` es NULL: los cambios vienen en `journal`
+    StateJournal journal;   // Cambios desde la última copia que tomó el lector
+    uint64_t sequence;      // Número de publicación
+} GameSnapshot;
+
+typedef struct SnapshotBuffer {
+    GameSnapshot snapshots[SNAPSHOT_BUFFER_COUNT];
+    atomic_uint latest;     // Índice de la última copia publicada | SNAPSHOT_FRESH
+
+    int wakeFd;             // eventfd que avisa al lector de una publicación; -1 sin `notify`
+
+    // Sólo el productor
+    unsigned writing;       // Índice de la copia que se escribe
+    unsigned lastPublished; // Índice de la última copia publicada (sólo se lee)
+    StateJournal unseen;    // Cambios que el lector todavía no tomó
+    uint64_t published;
+
+    // Sólo el lector
+    unsigned reading;       // Índice de la copia que se lee
+} SnapshotBuffer;
+
+// Constructor y Destructor
+SnapshotBuffer *SnapshotBuffer_create(const GameState *gameState, bool notify);
+void SnapshotBuffer_destroy(SnapshotBuffer *buffer);
+
+// Métodos de la clase
+void SnapshotBuffer_publish(SnapshotBuffer *buffer, const GameState *gameState, StateJournal *changes);
+const GameSnapshot *SnapshotBuffer_read(SnapshotBuffer *buffer, bool *isNew);
+bool SnapshotBuffer_wait(SnapshotBuffer *buffer, int timeoutMs);
+const GameSnapshot *SnapshotBuffer_lastPublished(const SnapshotBuffer *buffer);
+
+#endif // SNAPSHOT_BUFFER_H
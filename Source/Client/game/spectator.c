@@ -12,6 +12,12 @@ Consulta el archivo LICENSE para más detalles.
 // BIBLIOTECAS DE PROYECTO
 #include "../game_status.h"
 #include "spectator.h"
+#include "Objects/brick.h"
+#include "Objects/ball.h"
+#include "../comunicaciones/stateCodec.h"
+#include "commandQueue.h"
+#include "jitterBuffer.h"
+#include "stateJson.h"
 
 
 // BIBLIOTECAS EXTERNAS
@@ -269,14 +275,16 @@ void espectadorGetList(const char *recibido) {
 /* Function: updateGameStateFromJson
    Descripción:
      Actualiza el estado del juego (`GameState`) basado en un mensaje JSON recibido. Procesa datos
-     relacionados con el jugador, las bolas, los ladrillos y otros atributos del juego.
+     relacionados con el jugador, las bolas, los ladrillos y otros atributos del juego. El mensaje se lee
+     en una sola pasada (`read_GameState_json`) y cada campo se escribe directamente en `gameState`.
 
    Params:
      jsonString - Cadena de texto que contiene el mensaje JSON con el estado del juego.
-     gameState - Puntero al estado del juego (`GameState *`) que será actualizado.
+     gameState - Puntero al estado del juego (`GameState *`) que será actualizado; normalmente el de una
+                 casilla de `gameState->commands`, que sólo se entrega a la simulación si el mensaje es válido.
 
    Returns:
-     - void: No retorna valores.
+     - bool: `true` si el mensaje era un `sendGameState` válido y se copió en `gameState`.
 
    Restriction:
      - `jsonString` debe ser una cadena válida y no nula.
@@ -289,117 +297,89 @@ void espectadorGetList(const char *recibido) {
 
    Problems:
      - Problema: Si `jsonString` no es un JSON válido, no se procesará correctamente.
-       - Solución: Registrar un mensaje de error en caso de fallo en `cJSON_Parse`.
-     - Problema: Si algún campo esperado no está presente en el JSON, los datos pueden quedar incompletos.
-       - Solución: Validar que los campos estén presentes antes de usarlos.
+       - Solución: Se devuelve `false` y el estado a medio escribir no se entrega a la simulación.
+     - Problema: Con `cJSON_Parse` y `cJSON_GetArrayItem` leer los ladrillos era O(n²) y reservaba un nodo
+       por ladrillo en cada mensaje.
+       - Solución: Lector en flujo sin árbol intermedio (`comunicaciones/jsonReader.h`).
 
    References:
-     - cJSON Documentation: https://github.com/DaveGamble/cJSON
+     - Ninguna referencia externa específica.
      */
-void updateGameStateFromJson(const char *jsonString, GameState *gameState) {
-
-    cJSON *json = cJSON_Parse(jsonString);
-
-    if (json == NULL) {
-
-        printf("Error al parsear JSON en UPDATEFROMJSON spectator:158\n");
-
-        return;
-
-    }
-
-
-    cJSON *command = cJSON_GetObjectItem(json, "command");
-
-    if (command != NULL && strcmp(command->valuestring, "sendGameState") == 0) {
-
-        // Actualizar el jugador
-
-        cJSON *playerJson = cJSON_GetObjectItem(json, "player");
-
-        if (playerJson != NULL) {
-
-            gameState->player.position.x = cJSON_GetObjectItem(playerJson, "positionX")->valueint;
-
-            gameState->player.position.y = cJSON_GetObjectItem(playerJson, "positionY")->valueint;
-
-            gameState->player.size.x = cJSON_GetObjectItem(playerJson, "sizeX")->valueint;
-
-            gameState->player.size.y = cJSON_GetObjectItem(playerJson, "sizeY")->valueint;
-
-            gameState->player.life = cJSON_GetObjectItem(playerJson, "lives")->valueint;
-
-            gameState->player.score = cJSON_GetObjectItem(playerJson, "score")->valueint;
-
-        }
-
-
-        // Actualizar las bolas
-
-        cJSON *ballsJson = cJSON_GetObjectItem(json, "balls");
-
-        if (ballsJson != NULL && cJSON_IsArray(ballsJson)) {
-
-            for (int i = 0; i < cJSON_GetArraySize(ballsJson) && i < gameState->maxBalls; i++) {
-
-                cJSON *ballJson = cJSON_GetArrayItem(ballsJson, i);
-
-                gameState->balls[i].active = cJSON_GetObjectItem(ballJson, "active")->valueint;
-
-                gameState->balls[i].position.x = cJSON_GetObjectItem(ballJson, "positionX")->valueint;
-
-                gameState->balls[i].position.y = cJSON_GetObjectItem(ballJson, "positionY")->valueint;
-
-                // Suponiendo que la velocidad y el radio de la bola son constantes o se manejan de otra manera
-
-            }
-
-        }
-
-
-        // Actualizar los ladrillos
-
-        cJSON *bricksJson = cJSON_GetObjectItem(json, "bricks");
+bool updateGameStateFromJson(const char *jsonString, GameState *gameState) {
+    return read_GameState_json(jsonString, strlen(jsonString), gameState);
+}
 
-        if (bricksJson != NULL && cJSON_IsArray(bricksJson)) {
+/* Function: espectadorDecodeGameBinary
+   Descripción:
+     Decodifica un mensaje `sendGameStateBin` (trama binaria en base64) en el decodificador del espectador,
+     que conserva el último keyframe entre mensajes. El estado resultante se copia después con
+     `StateDecoder_applyTo`.
 
-            for (int i = 0; i < cJSON_GetArraySize(bricksJson); i++) {
+   Params:
+     recibido - Mensaje recibido con el campo "data".
 
-                cJSON *brickJson = cJSON_GetArrayItem(bricksJson, i);
+   Returns:
+     - const StateDecoder *: El decodificador con el estado reconstruido, o NULL si la trama se descartó.
 
-                int row = i / gameState->bricksPerLine;
-                int col = i % gameState->bricksPerLine;
+   Restriction:
+     - `recibido` debe contener el campo "data" con la trama en base64.
 
-                gameState->bricks[row][col].active = cJSON_GetObjectItem(brickJson, "active")->valueint;
+   Problems:
+     - Problema: Los deltas que llegan antes del primer keyframe no se pueden aplicar.
+       - Solución: El decodificador los descarta y el estado se actualiza con el siguiente keyframe.
+     - Problema: Con un buffer fijo de 16 KB las tramas más grandes (unas 3950 bolas activas) no se podían
+       decodificar y se descartaban sin aviso.
+       - Solución: El buffer crece hasta el tamaño decodificado del campo "data" (tres bytes por cada cuatro
+         caracteres base64) y cada trama descartada se registra.
 
-                // Puedes agregar más propiedades del ladrillo si es necesario
+   References:
+     - Ninguna referencia externa específica.
+*/
+static const StateDecoder *espectadorDecodeGameBinary(const char *recibido) {
+    static StateDecoder *decoder = NULL;
+    static uint8_t *frame = NULL;     // Crece con la trama más grande recibida
+    static size_t frameCapacity = 0;
+
+    const char *data = strstr(recibido, "\"data\":\"");
+    if (data == NULL) {
+        fprintf(stderr, "Error: Trama binaria sin campo data\n");
+        return NULL;
+    }
+    data += strlen("\"data\":\"");
+    const char *end = strchr(data, '"');
+    size_t textLength = (end != NULL) ? (size_t)(end - data) : strlen(data);
 
-            }
+    if (decoder == NULL) {
+        decoder = StateDecoder_create();
+        if (decoder == NULL) return NULL;
+    }
 
+    size_t needed = textLength * 3 / 4;
+    if (needed > frameCapacity) {
+        uint8_t *grown = realloc(frame, needed);
+        if (grown == NULL) {
+            fprintf(stderr, "Error: Trama binaria descartada, sin memoria para %zu bytes\n", needed);
+            return NULL;
         }
-
-
-        // Actualizar otros campos del estado del juego
-
-        gameState->gameOver = cJSON_GetObjectItem(json, "gameOver")->valueint;
-
-        gameState->pause = cJSON_GetObjectItem(json, "paused")->valueint;
-
-        gameState->winner = cJSON_GetObjectItem(json, "winner")->valueint;
-
-        gameState->levelsCompleted = cJSON_GetObjectItem(json, "levelsCompleted")->valueint;
-
+        frame = grown;
+        frameCapacity = needed;
     }
 
-
-    cJSON_Delete(json); // Liberar la memoria del JSON
-
+    size_t length = StateCodec_base64Decode(data, textLength, frame, frameCapacity);
+    if (length == 0 || !StateDecoder_decode(decoder, frame, length)) {
+        fprintf(stderr, "Error: Trama binaria descartada (%zu bytes decodificados)\n", length);
+        return NULL;
+    }
+    return decoder->hasKey ? decoder : NULL;
 }
 
 /* Function: espectadorUpdateGame
    Descripción:
-     Actualiza el estado del juego (`GameState`) utilizando los datos recibidos en formato JSON.
-     Asegura la exclusividad de acceso al `GameState` utilizando un mutex.
+     Actualiza el estado del juego (`GameState`) utilizando los datos recibidos, ya sea en formato JSON
+     o como trama binaria (`sendGameStateBin`). El mensaje se interpreta aquí, en el hilo de red, sobre el
+     estado propio de una casilla de `gameState->commands`, marcado con su hora de llegada; la simulación lo
+     guarda en `gameState->playout` en su siguiente paso (`apply_game_commands`) y lo muestra con el retraso
+     de reproducción, así que no se toma `gameStateMutex` durante el parseo.
 
    Params:
      recibido - Cadena de texto que contiene el mensaje JSON con el estado del juego.
@@ -417,6 +397,11 @@ void updateGameStateFromJson(const char *jsonString, GameState *gameState) {
    Problems:
      - Problema: Si `recibido` es NULL o no se puede obtener el estado del juego, no se realizará ninguna operación.
        - Solución: Validar los parámetros antes de proceder y registrar errores.
+     - Problema: Si la cola de comandos está llena, el estado recibido no llega a la simulación. Con tramas
+       binarias, un keyframe que no pasara por el decodificador dejaría inservibles los deltas siguientes.
+       - Solución: La trama se decodifica antes de reservar la casilla, así que el decodificador la guarda
+         siempre; sólo se pierde la copia para la simulación. El siguiente mensaje, JSON completo o delta sobre
+         el keyframe guardado, vuelve a traer el estado entero.
 
    References:
      - Ninguna referencia externa específica.
@@ -434,9 +419,35 @@ void espectadorUpdateGame(const char *recibido) {
         return;
     }
 
-    pthread_mutex_lock(&gameStateMutex); // Bloquear el mutex antes de modificar gameState
-    updateGameStateFromJson(recibido, gameState);
-    pthread_mutex_unlock(&gameStateMutex); // Desbloquear el mutex después de la modificación
+    long long receivedAt = JitterBuffer_now(); // Antes de interpretar: el parseo no cuenta como retraso de la red.
+
+    // Las tramas binarias pasan siempre por el decodificador, haya casilla libre o no: los deltas siguientes
+    // dependen del keyframe que guarda.
+    const StateDecoder *decoder = NULL;
+    if (strstr(recibido, "\"" STATE_CODEC_COMMAND "\"") != NULL) {
+        decoder = espectadorDecodeGameBinary(recibido);
+        if (decoder == NULL) {
+            return;
+        }
+    }
+
+    GameCommand *command = CommandQueue_reserve(gameState->commands);
+    if (command == NULL) {
+        return; // La simulación va atrasada; el siguiente mensaje trae el estado entero.
+    }
+
+    bool updated = true;
+    if (decoder != NULL) {
+        StateDecoder_applyTo(decoder, command->state);
+    } else {
+        updated = updateGameStateFromJson(recibido, command->state);
+    }
+
+    if (updated) {
+        command->type = GAME_COMMAND_SPECTATOR_STATE;
+        command->receivedAt = receivedAt;
+        CommandQueue_commit(gameState->commands);
+    }
 }
 
 /* Function: DrawPlayerList
@@ -498,6 +509,9 @@ void DrawPlayerList() {
    Descripción:
      Permite al usuario navegar por la lista de jugadores utilizando las teclas de dirección y seleccionar
      un jugador al presionar Enter. Envía la selección al servidor.
+     El servidor contesta a la selección con el último estado del jugador, así que antes de enviarla se
+     registra `espectadorUpdateGame` como callback y se vacía el búfer de reproducción: ese primer estado ya
+     pertenece al jugador nuevo.
 
    Params:
      players - Puntero a la estructura `PlayerList` que contiene la lista de jugadores.
@@ -515,6 +529,9 @@ void DrawPlayerList() {
    Problems:
      - Problema: Si no hay jugadores disponibles, la navegación y selección no tendrán efecto.
        - Solución: Validar que la lista no esté vacía y registrar mensajes para depuración.
+     - Problema: Si el callback se registrara en el siguiente paso (rama SPECTATOR de `update_game_state`), el
+       estado inicial llegaría todavía a `espectadorGetList` y se perdería; con un jugador en pausa no llega otro.
+       - Solución: Registrar `espectadorUpdateGame` antes de `comServer_sendChoosenPlayer`.
 
    References:
      - Ninguna referencia externa específica.
@@ -554,9 +571,11 @@ void UpdatePlayerList(const PlayerList *players) {
     if (IsKeyPressed(KEY_ENTER)) {
 
         printf("Selected Player: %s (UUID: %s)\n", players->playerNames[selectedPlayerIndex], players->playerUUIDs[selectedPlayerIndex]);
+        GameState *gameState =  getGameState();
         ComServer *comServer = ComServer_create();
+        JitterBuffer_clear(gameState->playout);
+        ComServer_registerCallback(comServer, espectadorUpdateGame);
         comServer_sendChoosenPlayer(comServer,players->playerUUIDs[selectedPlayerIndex]);
-        GameState *gameState =  getGameState();
         gameState->comunicationRunning=false;
         setCurrentScreen(SPECTATOR);
     }
@@ -0,0 +1,114 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "stateJournal.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <string.h>
+
+
+/* Function: StateJournal_clear
+   Descripción:
+     Vacía la bitácora de cambios.
+
+   Params:
+     journal - Bitácora a vaciar.
+
+   Returns:
+     - void: No retorna valores.
+*/
+void StateJournal_clear(StateJournal *journal) {
+    journal->count = 0;
+    journal->dirty = 0;
+    journal->fullSync = false;
+}
+
+/* Function: StateJournal_record
+   Descripción:
+     Registra un cambio en la bitácora. Si ya no hay espacio, la bitácora deja de guardar eventos y
+     solicita una sincronización completa.
+
+   Params:
+     journal - Bitácora donde se registra el evento.
+     type - Tipo de cambio.
+     a - Primer dato del evento (fila, índice de bola, vidas o puntaje según el tipo).
+     b - Segundo dato del evento (columna para ladrillos, 0 en otro caso).
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Debe llamarse con `gameStateMutex` tomado.
+
+   Example:
+     StateJournal_record(gameState->journal, JOURNAL_BRICK_DESTROYED, i, j);
+
+   Problems:
+     - Problema: Si el emisor no vacía la bitácora a tiempo (por ejemplo, en modo espectador), se llenaría.
+       - Solución: Al llenarse se marca `fullSync` y se descartan los eventos siguientes.
+
+   References:
+     - Ninguna referencia externa específica.
+*/
+void StateJournal_record(StateJournal *journal, JournalEventType type, int a, int b) {
+    switch (type) {
+        case JOURNAL_BRICK_DESTROYED: journal->dirty |= JOURNAL_DIRTY_BRICKS; break;
+        case JOURNAL_BALL_SPAWN:
+        case JOURNAL_BALL_DESPAWN:    journal->dirty |= JOURNAL_DIRTY_BALLS; break;
+        case JOURNAL_PADDLE_MOVE:
+        case JOURNAL_PADDLE_RESIZE:   journal->dirty |= JOURNAL_DIRTY_PADDLE; break;
+        case JOURNAL_LIFE:
+        case JOURNAL_SCORE:           journal->dirty |= JOURNAL_DIRTY_STATS; break;
+        case JOURNAL_BOARD_RESET:
+            journal->dirty |= JOURNAL_DIRTY_BRICKS | JOURNAL_DIRTY_BALLS | JOURNAL_DIRTY_PADDLE | JOURNAL_DIRTY_STATS;
+            journal->fullSync = true;
+            break;
+    }
+
+    if (journal->fullSync) {
+        return;  // Se leerá el estado completo, los eventos ya no aportan nada
+    }
+    if (journal->count >= STATE_JOURNAL_CAPACITY) {
+        journal->fullSync = true;
+        return;
+    }
+    journal->events[journal->count++] = (JournalEvent){ type, a, b };
+}
+
+/* Function: StateJournal_append
+   Descripción:
+     Agrega los eventos acumulados al final de `out` y vacía la bitácora original. Si no caben, `out`
+     pide una sincronización completa.
+
+   Params:
+     journal - Bitácora que se vacía.
+     out - Bitácora de destino, que conserva sus eventos anteriores.
+
+   Returns:
+     - void: No retorna valores.
+
+   Example:
+     StateJournal_append(gameState->journal, &buffer->unseen);
+*/
+void StateJournal_append(StateJournal *journal, StateJournal *out) {
+    out->dirty |= journal->dirty;
+    out->fullSync = out->fullSync || journal->fullSync;
+    if (!out->fullSync) {
+        if (out->count + journal->count > STATE_JOURNAL_CAPACITY) {
+            out->fullSync = true;
+        } else {
+            memcpy(out->events + out->count, journal->events, (size_t)journal->count * sizeof(JournalEvent));
+            out->count += journal->count;
+        }
+    }
+    StateJournal_clear(journal);
+}
@@ -0,0 +1,67 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef STATE_JOURNAL_H
+#define STATE_JOURNAL_H
+
+#include <stdbool.h>
+
+/*
+ * Header: State Journal
+ * Bitácora de cambios del estado del juego. La lógica del juego registra aquí cada cambio relevante
+ * (ladrillo destruido, bola creada o perdida, raqueta movida o redimensionada, vidas y puntaje) y la
+ * simulación la vacía cada vez que publica el estado para el envío (`broadcast_tick`), de modo que el
+ * emisor no necesita recorrer todo el tablero.
+ *
+ * Si la bitácora se llena antes de vaciarse, o si el tablero se reinicia, se marca `fullSync` y el
+ * emisor debe volver a leer el estado completo.
+ *
+ * Restriction:
+ *   - Se escribe y se vacía con `gameStateMutex` tomado.
+ */
+
+#define STATE_JOURNAL_CAPACITY 256
+
+typedef enum {
+    JOURNAL_BRICK_DESTROYED,  // a = fila, b = columna
+    JOURNAL_BALL_SPAWN,       // a = índice de la bola
+    JOURNAL_BALL_DESPAWN,     // a = índice de la bola
+    JOURNAL_PADDLE_MOVE,
+    JOURNAL_PADDLE_RESIZE,
+    JOURNAL_LIFE,             // a = vidas actuales
+    JOURNAL_SCORE,            // a = puntaje actual
+    JOURNAL_BOARD_RESET
+} JournalEventType;
+
+// Bits resumidos de lo que cambió desde el último vaciado
+#define JOURNAL_DIRTY_BRICKS  0x01
+#define JOURNAL_DIRTY_BALLS   0x02
+#define JOURNAL_DIRTY_PADDLE  0x04
+#define JOURNAL_DIRTY_STATS   0x08
+
+typedef struct {
+    JournalEventType type;
+    int a;
+    int b;
+} JournalEvent;
+
+typedef struct {
+    JournalEvent events[STATE_JOURNAL_CAPACITY];
+    int count;
+    unsigned int dirty;
+    bool fullSync;
+} StateJournal;
+
+// Métodos de la clase
+void StateJournal_clear(StateJournal *journal);
+void StateJournal_record(StateJournal *journal, JournalEventType type, int a, int b);
+void StateJournal_append(StateJournal *journal, StateJournal *out);
+
+#endif // STATE_JOURNAL_H
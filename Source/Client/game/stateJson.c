@@ -0,0 +1,350 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "stateJson.h"
+#include "Objects/brick.h"
+#include "Objects/ball.h"
+#include "../comunicaciones/jsonReader.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <cjson/cJSON.h>
+#include <limits.h>
+#include <math.h>
+
+
+/* Function: generate_GameState_json
+   Descripción:
+     Genera una representación JSON del estado actual del juego a partir del objeto `GameState`.
+     Incluye información sobre el jugador, las pelotas activas, los ladrillos, y el estado general del juego.
+
+   Params:
+     gameState - Puntero al estado global del juego (`GameState *`), que contiene todos los detalles necesarios
+                 para construir la representación JSON.
+
+   Returns:
+     - char*: Cadena de texto con la representación JSON del estado del juego.
+       Nota: La memoria de la cadena debe liberarse después de usarla para evitar fugas de memoria.
+
+   Restriction:
+     - Se debe garantizar que el `gameState` esté correctamente inicializado antes de llamar a esta función.
+     - El llamador debe liberar la memoria de la cadena JSON devuelta con `free`.
+
+   Example:
+     GameState *gameState = getGameState();
+     char *jsonString = generate_GameState_json(gameState);
+     printf("JSON: %s\n", jsonString);
+     free(jsonString); // Liberar la memoria asignada.
+
+   Problems:
+     - Problema: Si algún campo del `GameState` no está inicializado, los datos generados en el JSON pueden
+       ser inconsistentes o incorrectos.
+       - Solución: Garantizar que los campos del `GameState` estén completamente inicializados antes de llamar
+         a esta función.
+
+   References:
+     - cJSON Documentation: https://github.com/DaveGamble/cJSON
+*/
+
+char* generate_GameState_json(const GameState *gameState) {
+    // Crear el objeto JSON raíz
+    cJSON *gameStateJSON = cJSON_CreateObject();
+
+    cJSON_AddStringToObject(gameStateJSON, "command", "sendGameState");
+
+    // Agregar información del jugador
+    cJSON *playerJSON = cJSON_CreateObject();
+    cJSON_AddNumberToObject(playerJSON, "positionX", gameState->player.position.x);
+    cJSON_AddNumberToObject(playerJSON, "positionY", gameState->player.position.y);
+    cJSON_AddNumberToObject(playerJSON, "sizeX", gameState->player.size.x);
+    cJSON_AddNumberToObject(playerJSON, "sizeY", gameState->player.size.y);
+    cJSON_AddNumberToObject(playerJSON, "lives", gameState->player.life);
+    cJSON_AddNumberToObject(playerJSON, "score", gameState->player.score);
+    cJSON_AddItemToObject(gameStateJSON, "player", playerJSON);
+
+    // Agregar información de las pelotas activas
+    cJSON *ballsArray = cJSON_CreateArray();
+    for (int i = 0; i < gameState->maxBalls; i++) {
+        cJSON *ballJSON = cJSON_CreateObject();
+        cJSON_AddBoolToObject(ballJSON, "active", ball_is_active(&gameState->balls, i));
+        cJSON_AddNumberToObject(ballJSON, "positionX", gameState->balls.x[i]);
+        cJSON_AddNumberToObject(ballJSON, "positionY", gameState->balls.y[i]);
+        cJSON_AddItemToArray(ballsArray, ballJSON);
+    }
+    cJSON_AddItemToObject(gameStateJSON, "balls", ballsArray);
+
+    // Agregar información de los ladrillos activos
+    cJSON *bricksArray = cJSON_CreateArray();
+    for (int i = 0; i < gameState->linesOfBricks; i++) {
+        for (int j = 0; j < gameState->bricksPerLine; j++) {
+            cJSON *brickJSON = cJSON_CreateObject();
+            cJSON_AddBoolToObject(brickJSON, "active", brick_is_active(&gameState->bricks, i, j));
+            cJSON_AddItemToArray(bricksArray, brickJSON);
+        }
+    }
+    cJSON_AddItemToObject(gameStateJSON, "bricks", bricksArray);
+
+    // Agregar estado general del juego
+    cJSON_AddBoolToObject(gameStateJSON, "gameOver", gameState->gameOver);
+    cJSON_AddBoolToObject(gameStateJSON, "paused", gameState->pause);
+    cJSON_AddBoolToObject(gameStateJSON, "winner", gameState->winner);
+    cJSON_AddNumberToObject(gameStateJSON, "levelsCompleted", gameState->levelsCompleted);
+
+    // Convertir el objeto JSON a una cadena
+    char *jsonString = cJSON_PrintUnformatted(gameStateJSON);
+
+    // Liberar memoria utilizada por cJSON
+    cJSON_Delete(gameStateJSON);
+
+    return jsonString;  // Recordar liberar esta memoria con `free`
+}
+
+
+/* Function: write_GameState_json
+   Descripción:
+     Escribe el estado del juego en el escritor con el mismo esquema que `generate_GameState_json`
+     (mismas claves, mismo orden), pero sin crear nodos de cJSON ni reservar memoria por mensaje.
+
+   Params:
+     writer - Escritor donde se agrega el mensaje; normalmente el del hilo (`JsonWriter_threadInstance`).
+     gameState - Estado del juego a serializar.
+
+   Returns:
+     - void: No retorna valores. El mensaje queda en `writer->data`.
+
+   Restriction:
+     - El llamador debe reiniciar el escritor con `JsonWriter_reset` antes de cada mensaje.
+     - Si `writer->failed` queda activo, el mensaje está incompleto y no debe enviarse.
+
+   Example:
+     JsonWriter *writer = JsonWriter_threadInstance();
+     JsonWriter_reset(writer);
+     write_GameState_json(writer, gameState);
+     ComServer_sendBuffer(writer->data);
+
+   Problems:
+     - Problema: Con cJSON cada envío reserva un nodo por ladrillo más la cadena final.
+       - Solución: El texto se agrega directamente a un buffer que se reutiliza entre envíos.
+     - Problema: Los números reales no se imprimen con la misma precisión que cJSON.
+       - Solución: Se escriben con hasta tres decimales; el esquema no cambia y a los espectadores
+         (`read_GameState_json`) les sobra esa precisión.
+
+   References:
+     - Ninguna referencia externa específica.
+*/
+void write_GameState_json(JsonWriter *writer, const GameState *gameState) {
+    JsonWriter_literal(writer, "{\"command\":\"sendGameState\",\"player\":{\"positionX\":");
+    JsonWriter_number(writer, gameState->player.position.x);
+    JsonWriter_literal(writer, ",\"positionY\":");
+    JsonWriter_number(writer, gameState->player.position.y);
+    JsonWriter_literal(writer, ",\"sizeX\":");
+    JsonWriter_number(writer, gameState->player.size.x);
+    JsonWriter_literal(writer, ",\"sizeY\":");
+    JsonWriter_number(writer, gameState->player.size.y);
+    JsonWriter_literal(writer, ",\"lives\":");
+    JsonWriter_int(writer, gameState->player.life);
+    JsonWriter_literal(writer, ",\"score\":");
+    JsonWriter_int(writer, gameState->player.score);
+    JsonWriter_literal(writer, "},\"balls\":[");
+
+    for (int i = 0; i < gameState->maxBalls; i++) {
+        Ball ball = ball_load(&gameState->balls, i);
+        if (i > 0) JsonWriter_literal(writer, ",");
+        JsonWriter_literal(writer, "{\"active\":");
+        JsonWriter_bool(writer, ball.active);
+        JsonWriter_literal(writer, ",\"positionX\":");
+        JsonWriter_number(writer, ball.position.x);
+        JsonWriter_literal(writer, ",\"positionY\":");
+        JsonWriter_number(writer, ball.position.y);
+        JsonWriter_literal(writer, "}");
+    }
+
+    JsonWriter_literal(writer, "],\"bricks\":[");
+    bool first = true;
+    for (int i = 0; i < gameState->linesOfBricks; i++) {
+        for (int j = 0; j < gameState->bricksPerLine; j++) {
+            if (!first) JsonWriter_literal(writer, ",");
+            first = false;
+            if (brick_is_active(&gameState->bricks, i, j)) {
+                JsonWriter_literal(writer, "{\"active\":true}");
+            } else {
+                JsonWriter_literal(writer, "{\"active\":false}");
+            }
+        }
+    }
+
+    JsonWriter_literal(writer, "],\"gameOver\":");
+    JsonWriter_bool(writer, gameState->gameOver);
+    JsonWriter_literal(writer, ",\"paused\":");
+    JsonWriter_bool(writer, gameState->pause);
+    JsonWriter_literal(writer, ",\"winner\":");
+    JsonWriter_bool(writer, gameState->winner);
+    JsonWriter_literal(writer, ",\"levelsCompleted\":");
+    JsonWriter_int(writer, gameState->levelsCompleted);
+    JsonWriter_literal(writer, "}");
+}
+
+// Convierte un número recibido a int. El cast directo de un double fuera de rango es comportamiento
+// indefinido, así que se satura en INT_MIN/INT_MAX como hacía `valueint` de cJSON; NaN se lee como 0.
+static int json_int(double value) {
+    if (isnan(value)) return 0;
+    if (value >= (double)INT_MAX) return INT_MAX;
+    if (value <= (double)INT_MIN) return INT_MIN;
+    return (int)value;
+}
+
+// Lee el objeto "player"
+static void read_player(JsonReader *reader, Player *player) {
+    const char *key;
+    size_t length;
+    double value = 0;
+
+    if (!JsonReader_beginObject(reader)) return;
+    while (JsonReader_nextKey(reader, &key, &length)) {
+        if (JsonReader_equals(key, length, "positionX")) {
+            if (JsonReader_number(reader, &value)) player->position.x = (float)value;
+        } else if (JsonReader_equals(key, length, "positionY")) {
+            if (JsonReader_number(reader, &value)) player->position.y = (float)value;
+        } else if (JsonReader_equals(key, length, "sizeX")) {
+            if (JsonReader_number(reader, &value)) player->size.x = (float)value;
+        } else if (JsonReader_equals(key, length, "sizeY")) {
+            if (JsonReader_number(reader, &value)) player->size.y = (float)value;
+        } else if (JsonReader_equals(key, length, "lives")) {
+            if (JsonReader_number(reader, &value)) player->life = json_int(value);
+        } else if (JsonReader_equals(key, length, "score")) {
+            if (JsonReader_number(reader, &value)) player->score = json_int(value);
+        } else {
+            JsonReader_skip(reader);
+        }
+    }
+}
+
+// Lee el arreglo "balls"; las bolas que no vienen en el arreglo quedan inactivas
+static void read_balls(JsonReader *reader, BallPool *balls) {
+    const char *key;
+    size_t length;
+    double value = 0;
+    bool active = false;
+    int i = 0;
+
+    if (!JsonReader_beginArray(reader)) return;
+    for (; JsonReader_nextElement(reader); i++) {
+        if (i >= balls->capacity) {
+            JsonReader_skip(reader);
+            continue;
+        }
+        if (!JsonReader_beginObject(reader)) return;
+        while (JsonReader_nextKey(reader, &key, &length)) {
+            if (JsonReader_equals(key, length, "active")) {
+                if (JsonReader_bool(reader, &active)) ball_set_active(balls, i, active);
+            } else if (JsonReader_equals(key, length, "positionX")) {
+                if (JsonReader_number(reader, &value)) balls->x[i] = (float)value;
+            } else if (JsonReader_equals(key, length, "positionY")) {
+                if (JsonReader_number(reader, &value)) balls->y[i] = (float)value;
+            } else {
+                JsonReader_skip(reader);
+            }
+        }
+    }
+    for (; i < balls->capacity; i++) {
+        ball_set_active(balls, i, false);
+    }
+}
+
+// Lee el arreglo "bricks": el elemento k es el ladrillo (k / cols, k % cols)
+static void read_bricks(JsonReader *reader, BrickGrid *bricks) {
+    const char *key;
+    size_t length;
+    bool active = false;
+    int total = bricks->rows * bricks->cols;
+
+    if (!JsonReader_beginArray(reader)) return;
+    for (int k = 0; JsonReader_nextElement(reader); k++) {
+        if (k >= total) {
+            JsonReader_skip(reader);
+            continue;
+        }
+        if (!JsonReader_beginObject(reader)) return;
+        while (JsonReader_nextKey(reader, &key, &length)) {
+            if (JsonReader_equals(key, length, "active")) {
+                if (JsonReader_bool(reader, &active)) brick_set_active(bricks, k / bricks->cols, k % bricks->cols, active);
+            } else {
+                JsonReader_skip(reader);
+            }
+        }
+    }
+}
+
+/* Function: read_GameState_json
+   Descripción:
+     Lee un mensaje `sendGameState` (el esquema de `write_GameState_json`) en una sola pasada y escribe cada
+     campo directamente en `gameState`, sin construir un árbol. Las claves pueden venir en cualquier orden y
+     las desconocidas se saltan.
+
+   Params:
+     json - Texto del mensaje.
+     length - Bytes de `json`.
+     gameState - Estado donde se escriben los campos; normalmente el de una casilla de la cola de comandos,
+                 que la simulación copia sólo si esta función devuelve `true`.
+
+   Returns:
+     - bool: `true` si el texto es JSON válido y su "command" es "sendGameState". Con `false`, `gameState`
+             puede haber quedado a medio escribir y debe descartarse.
+
+   Example:
+     if (read_GameState_json(recibido, strlen(recibido), command->state)) {
+         CommandQueue_commit(gameState->commands);
+     }
+
+   Problems:
+     - Problema: Con cJSON el mensaje completo se convertía en un árbol (un nodo por ladrillo) y cada
+       `cJSON_GetArrayItem` recorría el arreglo desde el inicio, así que leer los ladrillos era O(n²).
+       - Solución: Cada ladrillo se escribe en cuanto se lee; un tablero de 64x64 se lee en microsegundos.
+
+   References:
+     - Ninguna referencia externa específica.
+*/
+bool read_GameState_json(const char *json, size_t length, GameState *gameState) {
+    JsonReader reader;
+    const char *key;
+    size_t keyLength;
+    const char *text;
+    size_t textLength;
+    double value = 0;
+    bool flag = false;
+    bool isState = false;
+
+    JsonReader_init(&reader, json, length);
+    if (!JsonReader_beginObject(&reader)) return false;
+    while (JsonReader_nextKey(&reader, &key, &keyLength)) {
+        if (JsonReader_equals(key, keyLength, "command")) {
+            isState = JsonReader_string(&reader, &text, &textLength)
+                      && JsonReader_equals(text, textLength, "sendGameState");
+        } else if (JsonReader_equals(key, keyLength, "player")) {
+            read_player(&reader, &gameState->player);
+        } else if (JsonReader_equals(key, keyLength, "balls")) {
+            read_balls(&reader, &gameState->balls);
+        } else if (JsonReader_equals(key, keyLength, "bricks")) {
+            read_bricks(&reader, &gameState->bricks);
+        } else if (JsonReader_equals(key, keyLength, "gameOver")) {
+            if (JsonReader_bool(&reader, &flag)) gameState->gameOver = flag;
+        } else if (JsonReader_equals(key, keyLength, "paused")) {
+            if (JsonReader_bool(&reader, &flag)) gameState->pause = flag;
+        } else if (JsonReader_equals(key, keyLength, "winner")) {
+            if (JsonReader_bool(&reader, &flag)) gameState->winner = flag;
+        } else if (JsonReader_equals(key, keyLength, "levelsCompleted")) {
+            if (JsonReader_number(&reader, &value)) gameState->levelsCompleted = json_int(value);
+        } else {
+            JsonReader_skip(&reader);
+        }
+    }
+    return !reader.failed && isState;
+}
@@ -0,0 +1,34 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef STATE_JSON_H
+#define STATE_JSON_H
+
+#include "../game_status.h"
+#include "../comunicaciones/jsonWriter.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Header: State JSON
+ * Serialización del estado del juego al mensaje `sendGameState`, y su lectura en los espectadores.
+ *
+ * Functions:
+ *   - generate_GameState_json: Genera el mensaje con cJSON; la cadena se libera con `free`.
+ *   - write_GameState_json: Genera el mismo esquema escribiendo directamente en un `JsonWriter`.
+ *   - read_GameState_json: Lee el mensaje en una sola pasada con un `JsonReader`, sin árbol intermedio.
+ */
+
+char* generate_GameState_json(const GameState *gameState);
+void write_GameState_json(JsonWriter *writer, const GameState *gameState);
+bool read_GameState_json(const char *json, size_t length, GameState *gameState);
+
+#endif // STATE_JSON_H
@@ -0,0 +1,38 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef TICK_INPUT_H
+#define TICK_INPUT_H
+
+#include <stdbool.h>
+
+/*
+ * Header: Tick Input
+ * Entrada del jugador para un paso de simulación, independiente de la fuente.
+ *
+ * La lógica del juego (`update_game`, `update_player_movement`, `update_ball_positions`) sólo lee esta
+ * estructura y nunca consulta el teclado, así que la misma simulación corre con la ventana de raylib
+ * (`gui/keyboardInput.h`), sin ventana (`headless.c`) o alimentada por la red.
+ *
+ * Fields:
+ *   - moveLeft / moveRight: Teclas mantenidas durante el paso.
+ *   - launch: Se pidió lanzar la bola (flanco, se consume en un solo paso).
+ *   - togglePause: Se pidió alternar la pausa (flanco).
+ *   - confirm: Se confirmó el reinicio tras ganar o perder (flanco).
+ */
+typedef struct {
+    bool moveLeft;
+    bool moveRight;
+    bool launch;
+    bool togglePause;
+    bool confirm;
+} TickInput;
+
+#endif // TICK_INPUT_H
@@ -14,14 +14,21 @@ Consulta el archivo LICENSE para más detalles.
 
 #include "game_status.h"
 #include "configuracion/configuracion.h"
+#include "game/ballKernel.h"
+#include "game/Objects/brick.h"
+#include "game/snapshotBuffer.h"
+#include "game/commandQueue.h"
+#include "game/jitterBuffer.h"
 
 // BIBLIOTECAS EXTERNAS
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 
 static GameState *gameStateInstance = NULL;
 float brickSpacing = 5.0f;
+pthread_mutex_t gameStateMutex;
 
 
 /* Function: initializeLevelSpeedChanged
@@ -101,7 +108,7 @@ References:
 
 void initGameState() {
     if (gameStateInstance == NULL) {
-        gameStateInstance = (GameState *)malloc(sizeof(GameState));
+        gameStateInstance = (GameState *)calloc(1, sizeof(GameState));
         gameStateInstance->currentScreen = MENU;
         gameStateInstance->isCameraEnabled = false;
         gameStateInstance->isPlayer = true;
@@ -114,35 +121,65 @@ void initGameState() {
         gameStateInstance->ball_speed_multiplier = 1.0f;
         gameStateInstance->brickSize = (Vector2){ 40, 20 }; // Tamaño predeterminado de los ladrillos
 
+        // Bitácora de cambios para el envío del estado
+        gameStateInstance->journal = (StateJournal *)malloc(sizeof(StateJournal));
+        if (!gameStateInstance->journal) {
+            perror("Error al asignar memoria para la bitácora de cambios");
+            exit(EXIT_FAILURE);
+        }
+        StateJournal_clear(gameStateInstance->journal);
+
         //Inicializar datos from INI
         gameStateInstance->maxBalls= get_config_int("game.maxBalls");
         gameStateInstance->bricksPerLine= get_config_int("game.bricksPerLine");
         gameStateInstance->linesOfBricks= get_config_int("game.linesOfBricks");
         gameStateInstance->playerMaxLife= get_config_int("game.playerMaxLife");
+        gameStateInstance->tickRate = get_config_int("game.tickRate");
+        if (gameStateInstance->tickRate <= 0) gameStateInstance->tickRate = DEFAULT_TICK_RATE;
+        gameStateInstance->tickSeconds = 1.0f / (float)gameStateInstance->tickRate;
+        gameStateInstance->broadcastEvery = get_config_int("network.broadcastEvery");
+        if (gameStateInstance->broadcastEvery <= 0) gameStateInstance->broadcastEvery = DEFAULT_BROADCAST_EVERY;
+        const char *broadcastMode = get_config_string("network.broadcastMode");
+        gameStateInstance->broadcastOnChange = broadcastMode == NULL || strcmp(broadcastMode, "tick") != 0;
         initializeLevelSpeedChanged(gameStateInstance);
 
 
 
-        // Asignar memoria para las bolas
-        gameStateInstance->balls = (Ball *)malloc(gameStateInstance->maxBalls * sizeof(Ball));
-        if (!gameStateInstance->balls) {
+        // Asignar memoria para las bolas (un solo bloque para todos sus campos)
+        if (!ball_pool_alloc(&gameStateInstance->balls, gameStateInstance->maxBalls)) {
             perror("Error al asignar memoria para las bolas");
             exit(EXIT_FAILURE);
         }
 
-        // Asignar memoria para los ladrillos
-        gameStateInstance->bricks = (Brick **)malloc(gameStateInstance->linesOfBricks * sizeof(Brick *));
-        if (!gameStateInstance->bricks) {
-            perror("Error al asignar memoria para las filas de ladrillos");
+        // Asignar memoria para los ladrillos (un solo bloque para todos sus campos)
+        if (!brick_grid_alloc(&gameStateInstance->bricks, gameStateInstance->linesOfBricks,
+                              gameStateInstance->bricksPerLine)) {
+            perror("Error al asignar memoria para los ladrillos");
+            exit(EXIT_FAILURE);
+        }
+
+        // Copias del estado que leen sin mutex el hilo de dibujo y el de envío
+        gameStateInstance->renderSnapshots = SnapshotBuffer_create(gameStateInstance, false);
+        gameStateInstance->networkSnapshots = SnapshotBuffer_create(gameStateInstance, true);
+        if (!gameStateInstance->renderSnapshots || !gameStateInstance->networkSnapshots) {
+            perror("Error al asignar memoria para las copias del estado");
             exit(EXIT_FAILURE);
         }
 
-        for (int i = 0; i < gameStateInstance->linesOfBricks; i++) {
-            gameStateInstance->bricks[i] = (Brick *)malloc(gameStateInstance->bricksPerLine * sizeof(Brick));
-            if (!gameStateInstance->bricks[i]) {
-                perror("Error al asignar memoria para los ladrillos por fila");
-                exit(EXIT_FAILURE);
-            }
+        // Comandos que llegan por la red; los aplica la simulación al inicio de cada paso
+        gameStateInstance->commands = CommandQueue_create(gameStateInstance);
+        if (!gameStateInstance->commands) {
+            perror("Error al asignar memoria para la cola de comandos");
+            exit(EXIT_FAILURE);
+        }
+
+        // Estados recibidos por el espectador; se muestran con `network.playoutDelay` ms de retraso
+        int playoutDelay = get_config_int("network.playoutDelay");
+        if (playoutDelay <= 0) playoutDelay = DEFAULT_PLAYOUT_DELAY_MS;
+        gameStateInstance->playout = JitterBuffer_create(gameStateInstance, playoutDelay);
+        if (!gameStateInstance->playout) {
+            perror("Error al asignar memoria para los estados recibidos");
+            exit(EXIT_FAILURE);
         }
     }
 }
@@ -12,8 +12,15 @@ Consulta el archivo LICENSE para más detalles.
 #define GAME_STATUS_H
 #include <raylib.h>
 #include <pthread.h>
+#include <stdint.h>
 
 #include "comunicaciones/comServer.h"
+#include "game/stateJournal.h"
+
+struct SnapshotBuffer;  // game/snapshotBuffer.h
+struct CommandQueue;    // game/commandQueue.h
+struct ReplayRecorder;  // game/replayLog.h
+struct JitterBuffer;    // game/jitterBuffer.h
 
 /*
  * Header: Game Data Structures
@@ -22,9 +29,10 @@ Consulta el archivo LICENSE para más detalles.
  *
  * Typedefs:
  *   - GameScreen: Enumeración que representa las distintas pantallas del juego.
- *   - Ball: Estructura que define las propiedades de una bola en el juego.
+ *   - Ball: Propiedades de una bola, como copia de trabajo de un elemento de `BallPool`.
+ *   - BallPool: Bolas del juego en estructura de arreglos (ver `game/Objects/ball.h`).
  *   - PowerType: Enumeración que representa los distintos poderes disponibles en el juego.
- *   - Brick: Estructura que define las propiedades de un ladrillo en el juego.
+ *   - BrickGrid: Ladrillos del tablero en estructura de arreglos (ver `game/Objects/brick.h`).
  *   - Player: Estructura que define las propiedades de un jugador en el juego.
  *   - GameState: Estructura principal que encapsula el estado general del juego.
  *
@@ -69,6 +77,24 @@ typedef struct Ball {
     int radius;
     bool active;
 } Ball;
+// Bolas del juego en estructura de arreglos, para que el paso las mueva en lotes con SIMD
+// (ver `game/ballKernel.c`). Cada arreglo tiene `stride` elementos (la capacidad redondeada a
+// BALL_POOL_LANES) alineados a 32 bytes; los elementos de relleno quedan siempre inactivos.
+// Usar los accesores de `game/Objects/ball.h`.
+#define BALL_POOL_LANES 8
+typedef struct BallPool {
+    int capacity;        // Bolas utilizables (`maxBalls`)
+    int stride;          // Elementos de cada arreglo
+    int words;           // Palabras de 64 bits de `active` y `pending`
+    uint64_t *active;    // Bit (i % 64) de la palabra i / 64: la bola está en juego
+    uint64_t *pending;   // Bolas que el lote dejó a la detección continua (uso interno de `handle_collisions`)
+    float *x;            // Centro de la bola
+    float *y;
+    float *speedX;       // Velocidad en píxeles por segundo
+    float *speedY;
+    float *radius;
+    void *block;         // Memoria de todos los arreglos
+} BallPool;
 // Enumeración para los poderes
 typedef enum PowerType {
     NONE,           // Sin poder
@@ -80,14 +106,21 @@ typedef enum PowerType {
     SPEED_DOWN,      // Reducir velocidad
     UPDATE_POINTS
 } PowerType;
-// Estructura Brick
-typedef struct Brick {
-    Vector2 position;  // Posición del ladrillo
-    bool active;       // Si el ladrillo está activo
-    int points;        // Puntos al destruirlo
-    Color color;       // Color del ladrillo
-    PowerType power;   // Tipo de poder asociado al ladrillo
-} Brick;
+// Ladrillos del tablero en estructura de arreglos: cada campo es un arreglo contiguo indexado por
+// `i * cols + j`, todos dentro de un solo bloque de memoria. Los datos que se leen en cada paso
+// (posición y actividad) quedan separados de los que casi no se leen (puntos, poder y color).
+// Usar los accesores de `game/Objects/brick.h`.
+typedef struct BrickGrid {
+    int rows;
+    int cols;
+    int wordsPerRow;     // Palabras de 64 bits de `active` por fila
+    uint64_t *active;    // Bit (j % 64) de la palabra i * wordsPerRow + j / 64: el ladrillo sigue en juego
+    Vector2 *position;   // Centro del ladrillo
+    int *points;         // Puntos al destruirlo
+    PowerType *power;    // Tipo de poder asociado al ladrillo
+    Color *color;        // Color del ladrillo
+    void *block;         // Memoria de todos los arreglos
+} BrickGrid;
 typedef struct Player {
     Vector2 position;
     Vector2 size;
@@ -98,8 +131,8 @@ typedef struct Player {
 } Player;
 typedef struct {
     Player player;
-    Ball *balls;
-    Brick **bricks;
+    BallPool balls;
+    BrickGrid bricks;
     int linesOfBricks;
     int maxBalls;
     int bricksPerLine;
@@ -118,7 +151,6 @@ typedef struct {
     bool running;  // Flag para el estado del juego
     bool comunicationRunning;
     ComServer *comServer;
-    pthread_t communicationThread;
     pthread_t sendStatusThread;
     pthread_t askForUsersThread;
     int playerMaxLife;
@@ -127,11 +159,24 @@ typedef struct {
     bool winner;
     bool bolaLanzada;
     bool isControllerActive;
+    StateJournal *journal;  // Cambios pendientes de enviar a los espectadores
+    struct SnapshotBuffer *renderSnapshots;   // Copias del estado para el hilo de dibujo
+    struct SnapshotBuffer *networkSnapshots;  // Copias del estado (y cambios) para el hilo de envío
+    struct CommandQueue *commands;            // Comandos de la red que aplica la simulación
+    struct ReplayRecorder *recorder;          // Grabación de la sesión; NULL si no se graba
+    struct JitterBuffer *playout;             // Estados recibidos por el espectador, en espera de mostrarse
+    int tickRate;           // Pasos de simulación por segundo
+    float tickSeconds;      // Duración fija de un paso (1 / tickRate)
+    int broadcastEvery;     // El estado para el envío se publica cada N pasos (`network.broadcastEvery`)
+    bool broadcastOnChange; // ...y sólo si algo cambió (`network.broadcastMode = "change"`)
+    int broadcastTicks;     // Pasos desde la última oportunidad de publicar
 } GameState;
 
 
 static const int screenWidth = 800;
 static const int screenHeight = 450;
+#define DEFAULT_TICK_RATE 60
+#define DEFAULT_BROADCAST_EVERY 1
 extern float brickSpacing;
 
 // Mutex para sincronizar el acceso a gameState
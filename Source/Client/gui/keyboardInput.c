@@ -0,0 +1,79 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+// BIBLIOTECAS DE PROYECTO
+#include "keyboardInput.h"
+
+// BIBLIOTECAS EXTERNAS
+#include <pthread.h>
+#include <raylib.h>
+
+static pthread_mutex_t latchMutex = PTHREAD_MUTEX_INITIALIZER;
+static TickInput latched = { 0 };  // Teclas mantenidas y pulsaciones aún no consumidas
+
+/* Function: KeyboardInput_sample
+   Descripción:
+     Lee el teclado de raylib y lo acumula para el siguiente paso de simulación. Las teclas mantenidas
+     reflejan el último cuadro; las pulsaciones se suman a las pendientes.
+
+   Params:
+     (Ninguno)
+
+   Returns:
+     - void: No retorna valores.
+
+   Restriction:
+     - Debe llamarse desde el hilo que dibuja, después de `EndDrawing`, que es cuando raylib actualiza el teclado.
+
+   Example:
+     EndDrawing();
+     KeyboardInput_sample();
+*/
+void KeyboardInput_sample(void) {
+    bool left = IsKeyDown(KEY_A);
+    bool right = IsKeyDown(KEY_D);
+    bool launch = IsKeyPressed(KEY_W);
+    bool pause = IsKeyPressed(KEY_P);
+    bool confirm = IsKeyPressed(KEY_ENTER);
+
+    pthread_mutex_lock(&latchMutex);
+    latched.moveLeft = left;
+    latched.moveRight = right;
+    latched.launch |= launch;
+    latched.togglePause |= pause;
+    latched.confirm |= confirm;
+    pthread_mutex_unlock(&latchMutex);
+}
+
+/* Function: KeyboardInput_take
+   Descripción:
+     Entrega la entrada acumulada para un paso de simulación y limpia las pulsaciones, que así se aplican
+     en un único paso.
+
+   Params:
+     input - Recibe la entrada del paso.
+
+   Returns:
+     - void: No retorna valores.
+
+   Example:
+     TickInput input;
+     KeyboardInput_take(&input);
+     update_game(gameState, &input);
+*/
+void KeyboardInput_take(TickInput *input) {
+    pthread_mutex_lock(&latchMutex);
+    *input = latched;
+    latched.launch = false;
+    latched.togglePause = false;
+    latched.confirm = false;
+    pthread_mutex_unlock(&latchMutex);
+}
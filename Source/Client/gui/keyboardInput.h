@@ -0,0 +1,30 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+#ifndef KEYBOARD_INPUT_H
+#define KEYBOARD_INPUT_H
+
+#include "../game/tickInput.h"
+
+/*
+ * Header: Keyboard Input
+ * Traduce el teclado de raylib a `TickInput`.
+ *
+ * raylib sólo actualiza el teclado en el hilo que dibuja (al terminar cada cuadro), mientras que la
+ * simulación corre en su propio hilo a `game.tickRate` pasos por segundo. El hilo de dibujo llama a
+ * `KeyboardInput_sample` una vez por cuadro y el de simulación a `KeyboardInput_take` una vez por paso:
+ * las teclas presionadas se acumulan hasta que un paso las consume, de modo que una pulsación no se
+ * pierde ni se aplica dos veces aunque haya más pasos que cuadros (o al revés).
+ */
+
+void KeyboardInput_sample(void);
+void KeyboardInput_take(TickInput *input);
+
+#endif // KEYBOARD_INPUT_H
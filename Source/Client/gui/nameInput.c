@@ -45,7 +45,7 @@ References:
 - Ninguna referencia externa específica.
 */
 
-void DrawNameInput(GameState *gameState) {
+void DrawNameInput(const GameState *gameState) {
     BeginDrawing();
     ClearBackground(RAYWHITE);
     DrawText("Enter your name:", 100, 100, 20, DARKGRAY);
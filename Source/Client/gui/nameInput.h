@@ -12,7 +12,7 @@ Consulta el archivo LICENSE para más detalles.
 #define NAMEINPUT_H
 
 #include "../game_status.h"
-void DrawNameInput(GameState *gameState);
+void DrawNameInput(const GameState *gameState);
 
 
 #endif //NAMEINPUT_H
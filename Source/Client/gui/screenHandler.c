@@ -14,7 +14,10 @@ Consulta el archivo LICENSE para más detalles.
 #include "screenHandler.h"
 #include "main_menu.h"
 #include "nameInput.h"
+#include "keyboardInput.h"
 #include "../game/spectator.h"
+#include "../game/snapshotBuffer.h"
+#include "../game/game_screen.h"
 // BIBLIOTECAS EXTERNAS
 #include <stdio.h>
 #include <raylib.h>
@@ -25,8 +28,6 @@ Consulta el archivo LICENSE para más detalles.
 #define WINDOW_HEIGHT 450
 #define TARGET_FPS 60
 
-pthread_mutex_t gameStateMutex;
-
 // ===================================================================================================
 // UPDATE GAME SCREEN
 
@@ -37,7 +38,8 @@ pthread_mutex_t gameStateMutex;
      Cambia entre las pantallas de menú, entrada de nombre, juego, selección de jugador y espectador.
 
    Params:
-     gameState - Puntero a la estructura `GameState` que contiene el estado actual del juego.
+     gameState - Copia del estado del juego a dibujar (ver `SnapshotBuffer_read`); la pantalla se toma de
+                 la copia para que coincida con el resto de lo que se dibuja.
 
    Returns:
      - void: No retorna valores.
@@ -59,13 +61,13 @@ pthread_mutex_t gameStateMutex;
    References:
      - Ninguna referencia externa específica.
 */
-void draw_game_state(GameState *gameState) {
+void draw_game_state(const GameState *gameState) {
     if (gameState == NULL) {
         fprintf(stderr, "Error: gameState es NULL\n");
         return;
     }
 
-    switch (getCurrentScreen()) {
+    switch (gameState->currentScreen) {
         case MENU:
             DrawMenu();
         break;
@@ -96,7 +98,9 @@ void draw_game_state(GameState *gameState) {
 /* Function: draw_thread
 Descripción:
 Hilo encargado de manejar el ciclo de renderizado del juego. Inicializa la ventana, establece el FPS,
-y renderiza continuamente el estado actual del juego mientras el juego esté en ejecución.
+y renderiza continuamente el estado actual del juego mientras el juego esté en ejecución. Cada cuadro dibuja
+la última copia publicada por la simulación (`gameState->renderSnapshots`) sin tomar `gameStateMutex`, así
+un paso largo de la simulación o del hilo de red no retrasa el cuadro.
 
 Params:
 arg - Puntero a la estructura `GameState` que contiene el estado actual del juego.
@@ -128,15 +132,15 @@ void *draw_thread(void *arg) {
     SetTargetFPS(TARGET_FPS);
 
     while (gameState->running && !WindowShouldClose()) {
-        pthread_mutex_lock(&gameStateMutex);
-        // Crear una copia local de las partes necesarias del estado del juego
-        GameScreen currentScreen = gameState->currentScreen;
-        pthread_mutex_unlock(&gameStateMutex);
+        // Dibujar la última copia publicada; nadie la modifica mientras se dibuja
+        const GameSnapshot *snapshot = SnapshotBuffer_read(gameState->renderSnapshots, NULL);
+        draw_game_state(&snapshot->state);
 
-        // Dibujar utilizando la copia local
-        draw_game_state(gameState);
+        // raylib actualizó el teclado al terminar el cuadro; se acumula para la simulación.
+        KeyboardInput_sample();
     }
 
+    release_game_screen(); // Los recursos de la GPU se liberan con la ventana todavía abierta
     CloseWindow(); // Cerrar ventana después de terminar el juego
 
     return NULL;
@@ -23,7 +23,7 @@ Consulta el archivo LICENSE para más detalles.
 
 
 // Funciones de dibujo
-void draw_game_state(GameState *gameState);
+void draw_game_state(const GameState *gameState);
 void *draw_thread(void *arg);
 
 #endif // SCREEN_HANDLER_H
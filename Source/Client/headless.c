@@ -0,0 +1,388 @@
+/*
+================================== LICENCIA ==================================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+==============================================================================================
+*/
+
+//BIBLIOTECAS EXTERNAS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+//BIBLIOTECAS DE PROYECTO
+#include "game_status.h"
+#include "game/game_logic.h"
+#include "game/Objects/ball.h"
+#include "game/tickInput.h"
+#include "game/commandQueue.h"
+#include "game/replayLog.h"
+
+/*
+ * Header: Headless
+ * Corre la simulación del juego sin ventana ni teclado: no llama a `InitWindow` ni enlaza raylib.
+ * Sirve para validar partidas del lado del servidor y para pruebas de carga con muchas partidas por máquina.
+ *
+ * La entrada la genera un jugador automático que sigue a la bola más baja, la relanza al perderla y
+ * confirma el paso al siguiente nivel. Con `--connect` además se registra como jugador en el servidor,
+ * envía su estado a los espectadores y aplica los poderes que lleguen por la red, como la pantalla GAME.
+ *
+ * Con `--replay` no juega: repite lo más rápido posible una sesión grabada (por el cliente con
+ * `game.recordFile` o por este programa con `--record`) y compara el estado final con el de la grabación,
+ * para probar cambios en la física o perfilar sesiones reales sin ventana.
+ *
+ * Uso:
+ *   ClientHeadless [--matches N] [--ticks N] [--realtime] [--connect NOMBRE] [--record ARCHIVO]
+ *   ClientHeadless --replay ARCHIVO
+ *
+ *   --matches N       Partidas a jugar una tras otra (por defecto 1).
+ *   --ticks N         Pasos máximos por partida (por defecto 10 minutos de juego a `game.tickRate`).
+ *   --realtime        Un paso cada `tickSeconds` en lugar de lo más rápido posible.
+ *   --connect NOMBRE  Conecta al servidor como el jugador NOMBRE (implica --realtime).
+ *   --record ARCHIVO  Graba las partidas en ARCHIVO.
+ *   --replay ARCHIVO  Repite la sesión grabada en ARCHIVO; termina con error si el resultado difiere.
+ */
+
+#define NANOS_PER_SECOND 1000000000LL
+#define DEFAULT_MATCH_SECONDS 600
+
+typedef struct {
+    int matches;
+    long long maxTicks;
+    bool realtime;
+    const char *playerName;
+    const char *recordFile;
+    const char *replayFile;
+} HeadlessOptions;
+
+static long long monotonic_nanos() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * NANOS_PER_SECOND + now.tv_nsec;
+}
+
+static void print_usage(const char *program) {
+    fprintf(stderr, "Uso: %s [--matches N] [--ticks N] [--realtime] [--connect NOMBRE] [--record ARCHIVO]\n"
+                    "     %s --replay ARCHIVO\n", program, program);
+}
+
+static bool parse_options(int argc, char **argv, HeadlessOptions *options) {
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--matches") == 0 && hasValue) {
+            options->matches = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ticks") == 0 && hasValue) {
+            options->maxTicks = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--realtime") == 0) {
+            options->realtime = true;
+        } else if (strcmp(argv[i], "--connect") == 0 && hasValue) {
+            options->playerName = argv[++i];
+            options->realtime = true;
+        } else if (strcmp(argv[i], "--record") == 0 && hasValue) {
+            options->recordFile = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && hasValue) {
+            options->replayFile = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    if (options->replayFile != NULL && (options->recordFile != NULL || options->playerName != NULL)) {
+        return false;  // La repetición no juega ni se conecta
+    }
+    return options->matches > 0 && options->maxTicks > 0;
+}
+
+/* Function: scripted_input
+   Descripción:
+     Jugador automático: mueve la raqueta hacia la bola activa más baja (apuntando un poco fuera del centro
+     de la raqueta para variar el ángulo), lanza la bola cuando no hay
+     ninguna en juego y confirma el siguiente nivel al ganar.
+
+   Params:
+     gameState - Estado del juego a observar.
+     input - Recibe la entrada del paso.
+
+   Returns:
+     - void: No retorna valores.
+*/
+static void scripted_input(const GameState *gameState, TickInput *input) {
+    memset(input, 0, sizeof(*input));
+
+    const BallPool *balls = &gameState->balls;
+    int target = -1;
+    for (int i = 0; i < balls->capacity; i++) {
+        if (ball_is_active(balls, i) && (target < 0 || balls->y[i] > balls->y[target])) {
+            target = i;
+        }
+    }
+
+    if (target >= 0) {
+        // Golpea la bola fuera del centro (y cambia de lado con el puntaje) para que no rebote en vertical para siempre.
+        float aim = (float)((gameState->player.score / 10) % 3 - 1) * gameState->player.size.x / 3;
+        float offset = balls->x[target] + aim - gameState->player.position.x;
+        float deadZone = gameState->player.size.x / 8;
+        input->moveLeft = offset < -deadZone;
+        input->moveRight = offset > deadZone;
+    } else {
+        input->launch = true;
+    }
+    input->confirm = gameState->winner;
+}
+
+// Los poderes llegan en el hilo de red; se encolan y la simulación los aplica al inicio del paso.
+static void on_server_message(const char *message) {
+    process_brick_update(message);
+}
+
+static bool connect_player(GameState *gameState, const char *playerName) {
+    strncpy(gameState->playerName, playerName, sizeof(gameState->playerName) - 1);
+    gameState->playerName[sizeof(gameState->playerName) - 1] = '\0';
+
+    gameState->comServer = ComServer_create();
+    if (gameState->comServer == NULL) {
+        fprintf(stderr, "Error al crear ComServer\n");
+        return false;
+    }
+    ComServer_registerCallback(gameState->comServer, on_server_message);
+    ComServer_sendPlayerName(gameState->comServer, gameState->playerName);
+    if (!ComServer_start(gameState->comServer)) {
+        fprintf(stderr, "Error al iniciar el reactor de red\n");
+        ComServer_destroy(gameState->comServer);
+        gameState->comServer = NULL;
+        return false;
+    }
+
+    if (pthread_create(&gameState->sendStatusThread, NULL, send_game_state_thread, (void *)gameState) != 0) {
+        fprintf(stderr, "Error al crear el hilo de envío de estado\n");
+        ComServer_destroy(gameState->comServer);
+        gameState->comServer = NULL;
+        return false;
+    }
+    gameState->comunicationRunning = true;
+    return true;
+}
+
+static void disconnect_player(GameState *gameState) {
+    if (!gameState->comunicationRunning) return;
+
+    pthread_mutex_lock(&gameStateMutex);
+    gameState->running = false;
+    pthread_mutex_unlock(&gameStateMutex);
+
+    pthread_join(gameState->sendStatusThread, NULL);
+    ComServer_destroy(gameState->comServer);
+    gameState->comServer = NULL;
+    gameState->comunicationRunning = false;
+}
+
+/* Function: play_match
+   Descripción:
+     Juega una partida completa con el jugador automático hasta perder todas las vidas o llegar a `maxTicks`.
+
+   Params:
+     gameState - Estado del juego.
+     options - Opciones de la ejecución.
+
+   Returns:
+     - long long: Pasos simulados.
+*/
+static long long play_match(GameState *gameState, const HeadlessOptions *options) {
+    const long long tickNanos = NANOS_PER_SECOND / gameState->tickRate;
+    long long nextTick = monotonic_nanos();
+    long long ticks = 0;
+
+    pthread_mutex_lock(&gameStateMutex);
+    start_match(gameState);
+    pthread_mutex_unlock(&gameStateMutex);
+
+    while (ticks < options->maxTicks && !gameState->gameOver) {
+        TickInput input;
+
+        pthread_mutex_lock(&gameStateMutex);
+        apply_game_commands(gameState);
+        scripted_input(gameState, &input);
+        simulate_tick(gameState, &input);
+        broadcast_tick(gameState);
+        pthread_mutex_unlock(&gameStateMutex);
+        ticks++;
+
+        if (options->realtime) {
+            nextTick += tickNanos;
+            struct timespec deadline = { nextTick / NANOS_PER_SECOND, nextTick % NANOS_PER_SECOND };
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {}
+        }
+    }
+    return ticks;
+}
+
+/* Function: replay_session
+   Descripción:
+     Repite una sesión grabada paso a paso, lo más rápido posible: antes de cada paso aplica los registros de
+     ese paso en el orden en que se grabaron (partida nueva, poderes recibidos, cambios de entrada) y luego
+     llama a `simulate_tick` con la entrada vigente. Al final compara el estado con el resumen grabado.
+
+   Params:
+     gameState - Estado del juego inicializado con la misma configuración que la grabación.
+     path - Archivo de la grabación.
+
+   Returns:
+     - int: EXIT_SUCCESS si el resultado coincide con la grabación (o si ésta no tiene resumen),
+            EXIT_FAILURE si no se pudo leer o si difiere.
+*/
+static int replay_session(GameState *gameState, const char *path) {
+    ReplayPlayer *player = ReplayPlayer_open(path);
+    if (player == NULL) {
+        fprintf(stderr, "No se pudo leer la grabación %s\n", path);
+        return EXIT_FAILURE;
+    }
+    if (!ReplayPlayer_matches(player, gameState)) {
+        fprintf(stderr, "La configuración (tickRate, tablero, maxBalls, playerMaxLife) no es la de la grabación\n");
+        ReplayPlayer_close(player);
+        return EXIT_FAILURE;
+    }
+
+    TickInput input = { 0 };
+    ReplayRecord record;
+    bool hasRecord = ReplayPlayer_read(player, &record);
+    bool hasSummary = false;
+    long long ticks = 0;
+    long long start = monotonic_nanos();
+
+    start_match(gameState);
+    while (hasRecord) {
+        // Registros que se aplicaron antes de este paso, en el mismo orden
+        while (hasRecord && record.tick == ticks && record.type != REPLAY_RECORD_END) {
+            switch (record.type) {
+                case REPLAY_RECORD_INPUT:
+                    input = record.input;
+                    break;
+                case REPLAY_RECORD_BRICK: {
+                    GameCommand *command = CommandQueue_reserve(gameState->commands);
+                    if (command != NULL) {
+                        command->type = GAME_COMMAND_BRICK_POWER;
+                        command->row = record.row;
+                        command->column = record.column;
+                        command->power = record.power;
+                        CommandQueue_commit(gameState->commands);
+                    }
+                    apply_game_commands(gameState);
+                    break;
+                }
+                case REPLAY_RECORD_RESET:
+                    start_match(gameState);
+                    break;
+                default:
+                    break;
+            }
+            hasRecord = ReplayPlayer_read(player, &record);
+        }
+        if (!hasRecord || (record.type == REPLAY_RECORD_END && record.tick == ticks)) {
+            hasSummary = hasRecord;
+            break;
+        }
+
+        simulate_tick(gameState, &input);
+        ticks++;
+    }
+    double seconds = (double)(monotonic_nanos() - start) / NANOS_PER_SECOND;
+    ReplayPlayer_close(player);
+
+    printf("repetición: pasos=%lld puntaje=%d niveles=%d vidas=%d en %.3f s (%.0f pasos/s)\n", ticks,
+           gameState->player.score, gameState->levelsCompleted, gameState->player.life, seconds,
+           seconds > 0 ? ticks / seconds : 0.0);
+
+    if (!hasSummary) {
+        printf("la grabación no tiene resumen final (la sesión no se cerró); no se compara el resultado\n");
+        return EXIT_SUCCESS;
+    }
+    const ReplaySummary *expected = &record.summary;
+    uint64_t hash = replay_state_hash(gameState);
+    if (expected->ticks != ticks || expected->score != gameState->player.score
+        || expected->lives != gameState->player.life || expected->levelsCompleted != gameState->levelsCompleted
+        || expected->hash != hash) {
+        printf("DIFIERE de la grabación: pasos=%lld puntaje=%d niveles=%d vidas=%d hash=%016llx (obtenido %016llx)\n",
+               expected->ticks, expected->score, expected->levelsCompleted, expected->lives,
+               (unsigned long long)expected->hash, (unsigned long long)hash);
+        return EXIT_FAILURE;
+    }
+    printf("resultado igual al de la grabación (hash %016llx)\n", (unsigned long long)hash);
+    return EXIT_SUCCESS;
+}
+
+/* Function: main
+   Funcion principal de la simulación sin ventana.
+
+   Params:
+     argc, argv - Opciones descritas en el encabezado de este archivo.
+
+   Returns:
+     EXIT_SUCCESS - Si se jugaron todas las partidas.
+     EXIT_FAILURE - Si las opciones son inválidas o no se pudo conectar al servidor.
+*/
+int main(int argc, char **argv) {
+    GameState *gameState = getGameState();
+    HeadlessOptions options = {
+        .matches = 1,
+        .maxTicks = (long long)DEFAULT_MATCH_SECONDS * gameState->tickRate,
+        .realtime = false,
+        .playerName = NULL,
+        .recordFile = NULL,
+        .replayFile = NULL
+    };
+    if (!parse_options(argc, argv, &options)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (options.replayFile != NULL) {
+        return replay_session(gameState, options.replayFile);
+    }
+
+    if (pthread_mutex_init(&gameStateMutex, NULL) != 0) {
+        fprintf(stderr, "Error al inicializar el mutex\n");
+        return EXIT_FAILURE;
+    }
+    gameState->running = true;
+    setCurrentScreen(GAME);
+
+    if (options.playerName != NULL && !connect_player(gameState, options.playerName)) {
+        pthread_mutex_destroy(&gameStateMutex);
+        return EXIT_FAILURE;
+    }
+    if (options.recordFile != NULL) {
+        gameState->recorder = ReplayRecorder_open(options.recordFile, gameState);
+        if (gameState->recorder == NULL) {
+            fprintf(stderr, "No se pudo crear la grabación %s\n", options.recordFile);
+            disconnect_player(gameState);
+            pthread_mutex_destroy(&gameStateMutex);
+            return EXIT_FAILURE;
+        }
+    }
+
+    long long totalTicks = 0;
+    long long start = monotonic_nanos();
+    for (int match = 1; match <= options.matches; match++) {
+        long long ticks = play_match(gameState, &options);
+        totalTicks += ticks;
+        printf("partida %d: pasos=%lld puntaje=%d niveles=%d vidas=%d%s\n", match, ticks,
+               gameState->player.score, gameState->levelsCompleted, gameState->player.life,
+               gameState->gameOver ? "" : " (límite de pasos)");
+    }
+    double seconds = (double)(monotonic_nanos() - start) / NANOS_PER_SECOND;
+
+    printf("%d partidas, %lld pasos en %.3f s (%.0f pasos/s, %.1fx tiempo real)\n", options.matches, totalTicks,
+           seconds, seconds > 0 ? totalTicks / seconds : 0.0,
+           seconds > 0 ? totalTicks * gameState->tickSeconds / seconds : 0.0);
+
+    disconnect_player(gameState);
+    ReplayRecorder_close(gameState->recorder, gameState);
+    gameState->recorder = NULL;
+    pthread_mutex_destroy(&gameStateMutex);
+    return EXIT_SUCCESS;
+}
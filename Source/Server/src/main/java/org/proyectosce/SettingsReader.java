@@ -22,6 +22,7 @@ Methods:
     - getInstance: Obtiene la instancia única de la clase.
     - getSocketAddress: Devuelve la dirección del socket desde el archivo de configuración.
     - getSocketPort: Devuelve el puerto del socket desde el archivo de configuración.
+    - getSelectorThreads: Devuelve la cantidad de hilos de eventos configurada.
 Example:
     SettingsReader reader = SettingsReader.getInstance();
     String address = reader.getSocketAddress();
@@ -125,4 +126,34 @@ public class SettingsReader {
     public int getSocketPort() {
         return ini.get("socket", "port", int.class);
     }
+
+    /* Function: getSelectorThreads
+    Devuelve la cantidad de hilos de eventos (`SelectorLoop`) que atienden a los clientes.
+    Params:
+        - No aplica.
+    Returns:
+        - int - cantidad de hilos, o 0 si no está configurada o no es un número (se usa un valor según los núcleos).
+    Restriction:
+        - La clave es opcional.
+    Example:
+        int hilos = SettingsReader.getInstance().getSelectorThreads();
+    Problems:
+        - Problema: Un valor mal escrito en settings.ini impedía iniciar el servidor.
+          - Solución: Se ignora con un aviso y se usa el valor automático.
+
+    References:
+
+    */
+    public int getSelectorThreads() {
+        String value = ini.get("socket", "selectorThreads");
+        if (value == null) {
+            return 0;
+        }
+        try {
+            return Integer.parseInt(value.trim());
+        } catch (NumberFormatException e) {
+            System.err.println("selectorThreads no es un número válido (" + value + "), se usa el valor automático");
+            return 0;
+        }
+    }
 }
@@ -106,6 +106,7 @@ public class CommandFactory {
                     return new HolaCommand();
 
                 case "sendGameState":
+                case "sendGameStateBin": // Trama binaria en base64, se reenvía sin interpretar
                     return crearSendGameStateCommand(params);
 
                 case "tipoCliente":
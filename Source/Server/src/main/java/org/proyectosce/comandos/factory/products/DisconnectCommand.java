@@ -83,8 +83,8 @@ public class DisconnectCommand implements Command {
             comServer.eliminarObservadores(cliente);
 
         } else {
-            // Si es un espectador, eliminarlo de las listas de observadores
-            comServer.eliminarEspectadorPorId(cliente.getId());
+            // Si es un espectador, quitarlo de los observadores del jugador que observa
+            comServer.eliminarEspectador(cliente);
         }
 
         // Eliminar de la lista general de clientes
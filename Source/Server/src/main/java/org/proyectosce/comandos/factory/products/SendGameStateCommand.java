@@ -15,13 +15,18 @@ package org.proyectosce.comandos.factory.products;
 
 import org.proyectosce.comunicaciones.Cliente;
 import org.proyectosce.comunicaciones.ComServer;
+import org.proyectosce.comunicaciones.InstantaneaJugador;
 import org.proyectosce.comunicaciones.SocketServer;
+import java.nio.ByteBuffer;
+import java.util.List;
 import java.util.Map;
-import java.util.Set;
 
 /*
  * Class: SendGameStateCommand
  * Representa un comando que envía el estado del juego a los observadores de un jugador específico.
+ * El estado también queda guardado en `ComServer` para enviárselo a quien empiece a observar al jugador.
+ * El mensaje se reenvía tal cual, por lo que sirve tanto para el formato JSON ("sendGameState") como para
+ * las tramas binarias codificadas en base64 ("sendGameStateBin").
  *
  * Attributes:
  *     - gameStateJson: String - El estado del juego en formato JSON que se enviará a los observadores.
@@ -75,12 +80,16 @@ public class SendGameStateCommand implements Command {
             throw new IllegalStateException("SendGameStateCommand no está configurado correctamente.");
         }
 
-        // Obtener los observadores del jugador
-        Set<Cliente> observadores = comServer.obtenerObservadores(jugador);
+        // Codificar una sola vez; todos los observadores comparten los mismos bytes
+        ByteBuffer estado = socketServer.codificarMensaje(gameStateJson);
 
-        // Enviar el estado del juego a cada observador
+        // Guardar el estado para los espectadores que se unan después, aunque ahora no haya observadores
+        List<Cliente> observadores = comServer.guardarEstado(jugador, gameStateJson, estado);
+        boolean delta = InstantaneaJugador.esDelta(gameStateJson);
+
+        // Enviar el estado del juego a cada observador; si alguno va atrasado se descartan sus estados viejos
         for (Cliente espectador : observadores) {
-            socketServer.enviarMensaje(espectador, gameStateJson);
+            socketServer.enviarEstadoJuego(espectador, estado, delta);
         }
     }
 
@@ -12,8 +12,11 @@ Cambios y Configuraciones del Proyecto3=================================
 */
 package org.proyectosce.comunicaciones;
 
+import java.nio.ByteBuffer;
+import java.nio.channels.SelectionKey;
 import java.nio.channels.SocketChannel;
 import java.util.UUID;
+import java.util.concurrent.atomic.AtomicBoolean;
 
 /*
  * Class: Cliente
@@ -25,6 +28,11 @@ import java.util.UUID;
  *     - channel: SocketChannel - Canal de comunicación asociado al cliente.
  *     - id: String - Identificador único generado para cada cliente.
  *     - nombre: String - Nombre del cliente.
+ *     - loop: SelectorLoop - Hilo de eventos que atiende el canal del cliente.
+ *     - key: SelectionKey - Registro del canal en el selector de `loop`.
+ *     - bufferLectura: ByteBuffer - Bytes recibidos que aún no forman un mensaje completo.
+ *     - colaSalida: ColaSalida - Mensajes pendientes de escribir en el canal, con límite para estados del juego.
+ *     - escrituraPendiente: AtomicBoolean - Indica si ya se pidió a `loop` vaciar la cola.
  *
  * Constructor:
  *     - Cliente(SocketChannel channel): Inicializa un cliente con el canal de comunicación y
@@ -35,6 +43,8 @@ import java.util.UUID;
  *     - getId(): Devuelve el identificador único del cliente.
  *     - getNombre(): Devuelve el nombre del cliente.
  *     - setNombre(String nombre): Establece el nombre del cliente.
+ *     - encolar(ByteBuffer mensaje): Agrega un mensaje de control a la cola de salida.
+ *     - encolarEstado(ByteBuffer mensaje, boolean delta): Agrega un estado del juego a la cola de salida.
  *     - toString(): Devuelve una representación en cadena del nombre del cliente.
  *
  * Example:
@@ -47,9 +57,16 @@ import java.util.UUID;
  * References:
  */
 public class Cliente {
+    private static final int TAMANO_INICIAL_LECTURA = 4096;
+
     private final SocketChannel channel;
     private final String id;  // Nuevo identificador único
     private String nombre;
+    private volatile SelectorLoop loop;
+    private volatile SelectionKey key;
+    private ByteBuffer bufferLectura = ByteBuffer.allocate(TAMANO_INICIAL_LECTURA);
+    private final ColaSalida colaSalida = new ColaSalida(ColaSalida.MAX_ESTADOS_POR_DEFECTO);
+    private final AtomicBoolean escrituraPendiente = new AtomicBoolean(false);
 
     /* Constructor: Cliente
         Inicializa un cliente con un canal de comunicación y un ID único.
@@ -103,6 +120,79 @@ public class Cliente {
         this.nombre = nombre;
     }
 
+    /* Function: encolar
+        Agrega un mensaje de control a la cola de salida. Lo escribe el hilo de eventos del cliente.
+
+        Params:
+            - mensaje: ByteBuffer - Bytes a enviar, incluido el delimitador.
+    */
+    public void encolar(ByteBuffer mensaje) {
+        colaSalida.agregarControl(mensaje);
+    }
+
+    /* Function: encolarEstado
+        Agrega un estado del juego a la cola de salida. Si el cliente va atrasado se descarta el estado
+        pendiente más viejo que se pueda descartar (ver `ColaSalida`).
+
+        Params:
+            - mensaje: ByteBuffer - Bytes a enviar, incluido el delimitador.
+            - delta: boolean - `true` si es una trama delta.
+
+        Returns:
+            - boolean: `true` si se descartó un estado anterior.
+    */
+    public boolean encolarEstado(ByteBuffer mensaje, boolean delta) {
+        return colaSalida.agregarEstado(mensaje, delta);
+    }
+
+    /* Function: getColaSalida
+        Devuelve la cola de mensajes pendientes de escribir.
+
+        Returns:
+            - ColaSalida: Cola de salida del cliente.
+    */
+    ColaSalida getColaSalida() {
+        return colaSalida;
+    }
+
+    /* Function: marcarEscrituraPendiente
+        Marca que se pidió vaciar la cola de salida.
+
+        Returns:
+            - boolean: `true` si no había una solicitud pendiente.
+    */
+    boolean marcarEscrituraPendiente() {
+        return escrituraPendiente.compareAndSet(false, true);
+    }
+
+    void limpiarEscrituraPendiente() {
+        escrituraPendiente.set(false);
+    }
+
+    SelectorLoop getLoop() {
+        return loop;
+    }
+
+    void setLoop(SelectorLoop loop) {
+        this.loop = loop;
+    }
+
+    SelectionKey getKey() {
+        return key;
+    }
+
+    void setKey(SelectionKey key) {
+        this.key = key;
+    }
+
+    ByteBuffer getBufferLectura() {
+        return bufferLectura;
+    }
+
+    void setBufferLectura(ByteBuffer bufferLectura) {
+        this.bufferLectura = bufferLectura;
+    }
+
     /* Function: toString
         Devuelve una representación en cadena del cliente, en este caso su nombre.
 
@@ -0,0 +1,216 @@
+/*
+================================== LICENCIA =================
+=================================
+MIT License
+Copyright (c) 2024  José Bernardo Barquero Bonilla,
+                    Jose Eduardo Campos Salazar,
+                    Jimmy Feng Feng,
+                    Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+=============================================================
+Cambios y Configuraciones del Proyecto3=================================
+*/
+package org.proyectosce.comunicaciones;
+
+import java.nio.ByteBuffer;
+import java.util.ArrayDeque;
+import java.util.Iterator;
+
+/*
+ * Class: ColaSalida
+ * Cola de mensajes pendientes de escribir para un cliente, con límite para los estados del juego.
+ *
+ * Los mensajes de control (listas de jugadores, poderes, avisos) nunca se descartan. Los estados del juego
+ * sí: si el cliente ya tiene `maxEstados` estados esperando, se descarta el estado más viejo que aún no se
+ * empezó a escribir. Así un espectador lento recibe menos cuadros, pero siempre los más recientes, y su
+ * cola no crece sin límite.
+ *
+ * Con tramas binarias los deltas se calculan contra el último keyframe, así que un keyframe sólo se descarta
+ * si ya hay uno más nuevo en la cola (o es el que llega), y entonces se descartan con él los deltas que
+ * dependen de él. Los deltas se descartan solos: ningún otro estado depende de ellos.
+ *
+ * Los productores son los hilos que ejecutan comandos; el consumidor es el hilo de eventos del cliente.
+ * Los mensajes entregados con `tomarLote` quedan "en vuelo" y no se descartan hasta `confirmarEscritura`.
+ *
+ * Attributes:
+ *     - pendientes: ArrayDeque<Entrada> - Mensajes en orden de envío.
+ *     - maxEstados: int - Máximo de estados del juego pendientes.
+ *     - estadosPendientes: int - Estados del juego en `pendientes`.
+ *     - enVuelo: int - Mensajes al inicio de la cola entregados al escritor.
+ *     - descartados: long - Total de estados descartados.
+ *
+ * Methods:
+ *     - agregarControl(ByteBuffer): Agrega un mensaje que nunca se descarta.
+ *     - agregarEstado(ByteBuffer): Agrega un estado del juego completo, descartando el más viejo si hace falta.
+ *     - agregarEstado(ByteBuffer, boolean): Agrega un estado completo o un delta.
+ *     - tomarLote(ByteBuffer[]): Entrega los primeros mensajes para una escritura agrupada.
+ *     - confirmarEscritura(): Quita de la cola los mensajes escritos por completo.
+ *
+ * Example:
+ *     ColaSalida cola = new ColaSalida(3);
+ *     cola.agregarEstado(ByteBuffer.wrap(bytes));
+ *     int cantidad = cola.tomarLote(lote);
+ *     channel.write(lote, 0, cantidad);
+ *     cola.confirmarEscritura();
+ */
+public class ColaSalida {
+    public static final int MAX_ESTADOS_POR_DEFECTO = 3;
+
+    private enum Tipo { CONTROL, COMPLETO, DELTA }
+
+    private record Entrada(ByteBuffer datos, Tipo tipo) {
+        boolean estado() {
+            return tipo != Tipo.CONTROL;
+        }
+    }
+
+    private final ArrayDeque<Entrada> pendientes = new ArrayDeque<>();
+    private final int maxEstados;
+    private int estadosPendientes = 0;
+    private int enVuelo = 0;
+    private long descartados = 0;
+
+    /* Constructor: ColaSalida
+        Params:
+            - maxEstados: int - Máximo de estados del juego pendientes por cliente (mínimo 1).
+    */
+    public ColaSalida(int maxEstados) {
+        this.maxEstados = Math.max(1, maxEstados);
+    }
+
+    /* Function: agregarControl
+        Agrega un mensaje de control. No se descarta nunca.
+
+        Params:
+            - datos: ByteBuffer - Bytes a enviar, incluido el delimitador.
+    */
+    public synchronized void agregarControl(ByteBuffer datos) {
+        pendientes.addLast(new Entrada(datos, Tipo.CONTROL));
+    }
+
+    /* Function: agregarEstado
+        Agrega un estado del juego completo (JSON o keyframe). Equivale a `agregarEstado(datos, false)`.
+
+        Params:
+            - datos: ByteBuffer - Bytes a enviar, incluido el delimitador.
+
+        Returns:
+            - boolean: `true` si se descartó un estado anterior.
+    */
+    public boolean agregarEstado(ByteBuffer datos) {
+        return agregarEstado(datos, false);
+    }
+
+    /* Function: agregarEstado
+        Agrega un estado del juego. Si ya hay `maxEstados` pendientes, descarta el más viejo que no esté en
+        vuelo y que se pueda descartar sin dejar inservibles a los que siguen.
+
+        Params:
+            - datos: ByteBuffer - Bytes a enviar, incluido el delimitador.
+            - delta: boolean - `true` si es una trama delta, que depende del keyframe anterior.
+
+        Returns:
+            - boolean: `true` si se descartó al menos un estado anterior.
+    */
+    public synchronized boolean agregarEstado(ByteBuffer datos, boolean delta) {
+        boolean descarto = false;
+        if (estadosPendientes >= maxEstados) {
+            descarto = descartarEstadoMasViejo(!delta);
+        }
+        pendientes.addLast(new Entrada(datos, delta ? Tipo.DELTA : Tipo.COMPLETO));
+        estadosPendientes++;
+        return descarto;
+    }
+
+    // Descarta el delta más viejo o, si antes hay un estado completo ya reemplazado por otro más nuevo, ese
+    // estado junto con los deltas que lo siguen. Nunca descarta el último estado completo.
+    private boolean descartarEstadoMasViejo(boolean entraCompleto) {
+        int ultimoCompleto = -1;
+        int i = 0;
+        for (Entrada entrada : pendientes) {
+            if (entrada.tipo() == Tipo.COMPLETO) {
+                ultimoCompleto = i;
+            }
+            i++;
+        }
+
+        int quitados = 0;
+        boolean quitandoDependientes = false;
+        Iterator<Entrada> it = pendientes.iterator();
+        for (i = 0; it.hasNext(); i++) {
+            Entrada entrada = it.next();
+            if (i < enVuelo || entrada.tipo() == Tipo.CONTROL) {
+                continue;
+            }
+            if (quitandoDependientes) {
+                if (entrada.tipo() != Tipo.DELTA) {
+                    break;
+                }
+                it.remove();
+                quitados++;
+            } else if (entrada.tipo() == Tipo.DELTA) {
+                it.remove();
+                quitados = 1;
+                break;
+            } else if (entraCompleto || i < ultimoCompleto) {
+                it.remove();
+                quitados = 1;
+                quitandoDependientes = true;
+            }
+        }
+        estadosPendientes -= quitados;
+        descartados += quitados;
+        return quitados > 0;  // 0 si todos los estados están en vuelo o sólo queda el último completo
+    }
+
+    /* Function: tomarLote
+        Copia en `lote` las referencias de los primeros mensajes de la cola y los marca en vuelo.
+
+        Params:
+            - lote: ByteBuffer[] - Arreglo a llenar.
+
+        Returns:
+            - int: Cantidad de mensajes entregados; 0 si la cola está vacía.
+    */
+    public synchronized int tomarLote(ByteBuffer[] lote) {
+        int cantidad = 0;
+        for (Entrada entrada : pendientes) {
+            if (cantidad == lote.length) break;
+            lote[cantidad++] = entrada.datos();
+        }
+        enVuelo = cantidad;
+        return cantidad;
+    }
+
+    /* Function: confirmarEscritura
+        Quita de la cola los mensajes ya escritos por completo. Un mensaje escrito a medias queda al inicio.
+
+        Returns:
+            - boolean: `true` si la cola quedó vacía.
+    */
+    public synchronized boolean confirmarEscritura() {
+        while (!pendientes.isEmpty() && !pendientes.peekFirst().datos().hasRemaining()) {
+            if (pendientes.pollFirst().estado()) {
+                estadosPendientes--;
+            }
+        }
+        enVuelo = 0;
+        return pendientes.isEmpty();
+    }
+
+    /* Function: estaVacia
+        Returns:
+            - boolean: `true` si no hay mensajes pendientes.
+    */
+    public synchronized boolean estaVacia() {
+        return pendientes.isEmpty();
+    }
+
+    /* Function: getDescartados
+        Returns:
+            - long: Total de estados del juego descartados para este cliente.
+    */
+    public synchronized long getDescartados() {
+        return descartados;
+    }
+}
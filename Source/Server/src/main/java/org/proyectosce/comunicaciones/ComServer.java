@@ -10,6 +10,7 @@ Consulta el archivo LICENSE para más detalles.
 */
 package org.proyectosce.comunicaciones;
 
+import java.nio.ByteBuffer;
 import java.util.*;
 import org.proyectosce.ui.MainWindow;
 import javax.swing.*;
@@ -26,9 +27,13 @@ import java.util.function.BiConsumer;
         - servidorActivo: boolean - Indica si el servidor está activo.
         - instance: ComServer - Instancia única de la clase (Singleton).
         - clients: Set<Cliente> - Conjunto de todos los clientes conectados.
+        - clientesPorId: Map<String, Cliente> - Clientes conectados indexados por ID.
         - jugadores: Set<Cliente> - Conjunto de jugadores registrados.
+        - jugadoresPorId: Map<String, Cliente> - Jugadores registrados indexados por ID.
         - observadores: Map<Cliente, Set<Cliente>> - Mapeo entre jugadores y sus observadores.
+        - jugadorObservado: Map<Cliente, Cliente> - Mapeo inverso: jugador que observa cada espectador.
         - espectadoresTemporales: Set<Cliente> - Conjunto de espectadores temporales.
+        - instantaneas: Map<Cliente, InstantaneaJugador> - Último estado codificado de cada jugador.
         - socketServer: SocketServer - Instancia del servidor de sockets.
         - updateCallback: BiConsumer<List<Cliente>, List<String>> - Función de actualización para listas.
         - mainWindow: MainWindow - Referencia a la ventana principal de la interfaz gráfica.
@@ -40,11 +45,13 @@ import java.util.function.BiConsumer;
         - getInstance: Devuelve la instancia única de la clase ComServer.
         - setMainWindow: Asigna la ventana principal (MainWindow) para interacción con la interfaz gráfica.
         - setUpdateCallback: Asigna la función de callback para actualizar listas de clientes.
-        - iniciarServidor: Inicia el servidor y escucha nuevas conexiones de clientes.
+        - iniciarServidor: Inicia el servidor y los hilos que atienden las conexiones de clientes.
+        - registrarConexion: Agrega un cliente recién conectado a la lista general.
         - eliminarCliente: Elimina un cliente de todas las listas y actualiza la interfaz.
         - registrarEspectadorTemporal: Registra a un cliente como espectador temporal.
         - registrarJugador: Registra a un cliente como jugador.
-        - registrarObservador: Asocia un cliente como observador de un jugador.
+        - registrarObservador: Asocia un cliente como observador de un jugador y le envía el último estado.
+        - guardarEstado: Guarda el último estado de un jugador y devuelve sus observadores.
         - obtenerClientes: Devuelve la lista de jugadores registrados.
         - obtenerNombresEspectadores: Devuelve los IDs de los espectadores únicos.
         - actualizarListas: Actualiza las listas de jugadores y espectadores en la interfaz gráfica.
@@ -64,6 +71,9 @@ import java.util.function.BiConsumer;
         server.iniciarServidor();
 
     Problems:
+        - Problema: Buscar un jugador por ID o quitar a un espectador recorría todos los jugadores y todos
+          los conjuntos de observadores, en cada comando "brick_pwr" y "GameSpectator" y en cada desconexión.
+          - Solución: Índices por ID y el mapeo inverso `jugadorObservado`; las búsquedas y las bajas son O(1).
 
     References:
 
@@ -72,9 +82,13 @@ public class ComServer {
     private volatile boolean servidorActivo = true;
     private static ComServer instance;
     private final Set<Cliente> clients = ConcurrentHashMap.newKeySet();
+    private final Map<String, Cliente> clientesPorId = new ConcurrentHashMap<>();
     private final Set<Cliente> jugadores = ConcurrentHashMap.newKeySet();
+    private final Map<String, Cliente> jugadoresPorId = new ConcurrentHashMap<>();
     private final Map<Cliente, Set<Cliente>> observadores = new ConcurrentHashMap<>();
+    private final Map<Cliente, Cliente> jugadorObservado = new ConcurrentHashMap<>();
     private final Set<Cliente> espectadoresTemporales = ConcurrentHashMap.newKeySet();
+    private final Map<Cliente, InstantaneaJugador> instantaneas = new ConcurrentHashMap<>();
     private final SocketServer socketServer = SocketServer.getInstance();
     private BiConsumer<List<Cliente>, List<String>> updateCallback;
     private MainWindow mainWindow;
@@ -116,18 +130,22 @@ public class ComServer {
     }
 
     /* Function: iniciarServidor
-        Inicia el servidor y escucha nuevas conexiones de clientes. Por cada cliente, se crea un nuevo hilo
-        para manejar la comunicación.
+        Inicia el servidor. Las conexiones las atienden los hilos de eventos de `SocketServer`; aquí sólo se
+        registra cada cliente nuevo en la lista general.
     */
     public void iniciarServidor() {
-        socketServer.abrirPuerto();
-        while (servidorActivo) {
-            Cliente nuevoCliente = socketServer.esperarCliente();
-            if (nuevoCliente != null) {
-                clients.add(nuevoCliente);
-                new Thread(new ClientHandler(nuevoCliente)).start();
-            }
-        }
+        socketServer.iniciar(this::registrarConexion);
+    }
+
+    /* Function: registrarConexion
+        Agrega un cliente recién conectado a la lista general y al índice por ID.
+
+        Params:
+            - cliente: Cliente - Cliente conectado.
+    */
+    private void registrarConexion(Cliente cliente) {
+        clients.add(cliente);
+        clientesPorId.put(cliente.getId(), cliente);
     }
 
     /* Function: eliminarCliente
@@ -138,8 +156,11 @@ public class ComServer {
     */
     public void eliminarCliente(Cliente cliente) {
         clients.remove(cliente);
-        jugadores.remove(cliente);
-        observadores.remove(cliente);
+        clientesPorId.remove(cliente.getId(), cliente);
+        eliminarJugador(cliente);
+        eliminarObservadores(cliente);
+        eliminarEspectador(cliente);
+        espectadoresTemporales.remove(cliente);
         actualizarListas();
     }
 
@@ -162,22 +183,88 @@ public class ComServer {
     */
     public void registrarJugador(Cliente cliente) {
         jugadores.add(cliente);
+        jugadoresPorId.put(cliente.getId(), cliente);
         observadores.putIfAbsent(cliente, ConcurrentHashMap.newKeySet());
         actualizarListas();
     }
 
     /* Function: registrarObservador
-        Asocia un cliente como observador de un jugador específico.
+        Asocia un cliente como observador de un jugador específico y le envía de inmediato el último estado
+        del jugador, si lo hay. Un espectador que se reconecta vuelve a pasar por aquí. Si el espectador ya
+        observaba a otro jugador, deja de recibir sus estados.
 
         Params:
             - jugador: Cliente - Cliente que actúa como jugador.
             - espectador: Cliente - Cliente que será registrado como observador del jugador.
+
+        Problems:
+            - Problema: Con deltas o con pocos estados por segundo, un espectador nuevo podía esperar hasta el
+              siguiente keyframe para ver algo.
+              - Solución: Recibe el último keyframe (o estado JSON) y el último delta guardados.
+            - Problema: Un estado transmitido mientras se registra el espectador podría llegarle antes que la
+              instantánea, que es más vieja.
+              - Solución: El registro y `guardarEstado` se sincronizan sobre la instantánea del jugador.
     */
     public void registrarObservador(Cliente jugador, Cliente espectador) {
-        observadores.computeIfAbsent(jugador, k -> ConcurrentHashMap.newKeySet()).add(espectador);
+        Cliente anterior = jugadorObservado.put(espectador, jugador);
+        if (anterior != null && anterior != jugador) {
+            obtenerObservadores(anterior).remove(espectador);
+        }
+
+        InstantaneaJugador instantanea = instantaneas.get(jugador);
+        if (instantanea == null) {
+            observadores.computeIfAbsent(jugador, k -> ConcurrentHashMap.newKeySet()).add(espectador);
+        } else {
+            synchronized (instantanea) {
+                observadores.computeIfAbsent(jugador, k -> ConcurrentHashMap.newKeySet()).add(espectador);
+                enviarInstantanea(instantanea, espectador);
+            }
+        }
         actualizarListas();
     }
 
+    /* Function: guardarEstado
+        Guarda el estado recibido de un jugador como su instantánea y devuelve los observadores a los que hay
+        que reenviarlo. Se guarda aunque el jugador no tenga observadores.
+
+        Params:
+            - jugador: Cliente - Jugador que envió el estado.
+            - mensaje: String - Mensaje recibido ("sendGameState" o "sendGameStateBin").
+            - estado: ByteBuffer - El mensaje codificado con `SocketServer.codificarMensaje`.
+
+        Returns:
+            - List<Cliente> - Copia de los observadores del jugador en este momento.
+    */
+    public List<Cliente> guardarEstado(Cliente jugador, String mensaje, ByteBuffer estado) {
+        if (!jugadores.contains(jugador)) {
+            return List.copyOf(obtenerObservadores(jugador));
+        }
+        InstantaneaJugador instantanea = instantaneas.computeIfAbsent(jugador, k -> new InstantaneaJugador());
+        synchronized (instantanea) {
+            instantanea.actualizar(mensaje, estado);
+            return List.copyOf(obtenerObservadores(jugador));
+        }
+    }
+
+    /* Function: enviarInstantanea
+        Envía a un espectador la instantánea de un jugador: el estado completo y, si lo hay, el último delta.
+
+        Params:
+            - instantanea: InstantaneaJugador - Instantánea del jugador observado.
+            - espectador: Cliente - Espectador que la recibe.
+    */
+    private void enviarInstantanea(InstantaneaJugador instantanea, Cliente espectador) {
+        ByteBuffer completo = instantanea.getCompleto();
+        if (completo == null) {
+            return;
+        }
+        socketServer.enviarEstadoJuego(espectador, completo, false);
+        ByteBuffer delta = instantanea.getDelta();
+        if (delta != null) {
+            socketServer.enviarEstadoJuego(espectador, delta, true);
+        }
+    }
+
     /* Function: obtenerClientes
         Devuelve la lista de jugadores registrados.
 
@@ -195,10 +282,8 @@ public class ComServer {
             - List<String> - Lista de IDs de observadores.
     */
     private List<String> obtenerNombresEspectadores() {
-        return observadores.values().stream()
-                .flatMap(Set::stream)
+        return jugadorObservado.keySet().stream()
                 .map(Cliente::getId)
-                .distinct()
                 .toList();
     }
 
@@ -218,19 +303,16 @@ public class ComServer {
     }
 
     /* Function: obtenerClientePorId
-        Busca y devuelve un cliente según su ID.
+        Busca y devuelve un jugador según su ID.
 
         Params:
-            - id: String - ID del cliente a buscar.
+            - id: String - ID del jugador a buscar.
 
         Returns:
-            - Cliente - Cliente encontrado, o null si no existe.
+            - Cliente - Jugador encontrado, o null si no existe.
     */
     public Cliente obtenerClientePorId(String id) {
-        return jugadores.stream()
-                .filter(cliente -> cliente.getId().equals(id))
-                .findFirst()
-                .orElse(null);
+        return id != null ? jugadoresPorId.get(id) : null;
     }
 
     /* Function: enviarListaDeJugadores
@@ -261,13 +343,15 @@ public class ComServer {
     }
 
     /* Function: eliminarJugador
-        Elimina a un cliente de la lista de jugadores.
+        Elimina a un cliente de la lista de jugadores junto con su último estado guardado.
 
         Params:
             - cliente: Cliente - Cliente a eliminar.
     */
     public void eliminarJugador(Cliente cliente) {
         jugadores.remove(cliente);
+        jugadoresPorId.remove(cliente.getId(), cliente);
+        instantaneas.remove(cliente);
     }
 
     /* Function: obtenerObservadores
@@ -290,39 +374,38 @@ public class ComServer {
             - cliente: Cliente - Jugador cuyos observadores serán eliminados.
     */
     public void eliminarObservadores(Cliente cliente) {
-        Set<Cliente> observadoresDelJugador = obtenerObservadores(cliente);
+        Set<Cliente> observadoresDelJugador = observadores.remove(cliente);
+        if (observadoresDelJugador == null) {
+            return;
+        }
         for (Cliente espectador : observadoresDelJugador) {
-            eliminarEspectador(espectador);
+            jugadorObservado.remove(espectador, cliente);
         }
-        observadores.remove(cliente);
     }
 
     /* Function: eliminarEspectador
-        Elimina a un cliente como espectador.
+        Quita a un espectador del conjunto de observadores del jugador que observa.
 
         Params:
             - cliente: Cliente - Cliente a eliminar como espectador.
     */
     public void eliminarEspectador(Cliente cliente) {
-        observadores.remove(cliente);
+        Cliente jugador = jugadorObservado.remove(cliente);
+        if (jugador != null) {
+            obtenerObservadores(jugador).remove(cliente);
+        }
     }
 
     /* Function: eliminarEspectadorPorId
-        Elimina a un observador de todos los jugadores según su ID.
+        Quita a un espectador, según su ID, del conjunto de observadores del jugador que observa.
 
         Params:
             - idObservador: String - ID del observador a eliminar.
     */
     public void eliminarEspectadorPorId(String idObservador) {
-        for (Map.Entry<Cliente, Set<Cliente>> entry : observadores.entrySet()) {
-            Cliente jugador = entry.getKey();
-            Set<Cliente> observadoresDelJugador = entry.getValue();
-
-            observadoresDelJugador.removeIf(observador -> observador.getId().equals(idObservador));
-
-            if (observadoresDelJugador.isEmpty()) {
-                observadores.remove(jugador);
-            }
+        Cliente espectador = clientesPorId.get(idObservador);
+        if (espectador != null) {
+            eliminarEspectador(espectador);
         }
     }
 
@@ -0,0 +1,102 @@
+/*
+================================== LICENCIA ================================
+MIT License
+Copyright (c) 2024 José Bernardo Barquero Bonilla,
+                   Jose Eduardo Campos Salazar,
+                   Jimmy Feng Feng,
+                   Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+============================================================================
+*/
+package org.proyectosce.comunicaciones;
+
+import java.nio.ByteBuffer;
+import java.util.Base64;
+
+/*
+ * Class: InstantaneaJugador
+ * Último estado completo de un jugador, ya codificado, para enviárselo a un espectador en cuanto empieza a
+ * observarlo en lugar de esperar al siguiente estado que transmita el jugador.
+ *
+ * Con mensajes "sendGameState" (JSON) cada mensaje es un estado completo y basta con el último. Con tramas
+ * "sendGameStateBin" un delta sólo se puede aplicar sobre el keyframe que lo precede, así que se guardan el
+ * último keyframe y el último delta posterior: el espectador recibe primero el keyframe y después el delta.
+ *
+ * Attributes:
+ *     - completo: ByteBuffer - Último estado completo (JSON o keyframe), o null.
+ *     - delta: ByteBuffer - Último delta posterior a `completo`, o null.
+ *
+ * Methods:
+ *     - actualizar(String, ByteBuffer): Guarda un estado recién recibido del jugador.
+ *     - getCompleto(): Devuelve el último estado completo.
+ *     - getDelta(): Devuelve el último delta posterior al estado completo.
+ *
+ * Example:
+ *     instantanea.actualizar(gameStateJson, socketServer.codificarMensaje(gameStateJson));
+ */
+public class InstantaneaJugador {
+    private static final String CAMPO_DATOS = "\"data\":\"";
+    private static final int TRAMA_DELTA = 2;  // StateFrameType del cliente: KEY = 1, DELTA = 2
+
+    private ByteBuffer completo;
+    private ByteBuffer delta;
+
+    /* Function: actualizar
+        Guarda un estado recibido del jugador. Un delta sin keyframe previo se ignora: no serviría para
+        reconstruir el estado.
+
+        Params:
+            - mensaje: String - Mensaje tal como lo envió el jugador.
+            - estado: ByteBuffer - El mismo mensaje codificado con `SocketServer.codificarMensaje`.
+    */
+    public synchronized void actualizar(String mensaje, ByteBuffer estado) {
+        if (esDelta(mensaje)) {
+            if (completo != null) {
+                delta = estado;
+            }
+        } else {
+            completo = estado;
+            delta = null;
+        }
+    }
+
+    /* Function: getCompleto
+        Returns:
+            - ByteBuffer: Último estado completo, o null si el jugador todavía no envió ninguno.
+    */
+    public synchronized ByteBuffer getCompleto() {
+        return completo;
+    }
+
+    /* Function: getDelta
+        Returns:
+            - ByteBuffer: Último delta posterior a `getCompleto()`, o null si no hay.
+    */
+    public synchronized ByteBuffer getDelta() {
+        return delta;
+    }
+
+    /* Function: esDelta
+        Lee el tipo de trama de un mensaje "sendGameStateBin" sin decodificarlo entero: los primeros cuatro
+        caracteres del base64 son los tres primeros bytes del encabezado (versión, tipo y secuencia).
+
+        Params:
+            - mensaje: String - Mensaje recibido.
+
+        Returns:
+            - boolean: `true` si es una trama delta; `false` para keyframes y mensajes JSON.
+    */
+    public static boolean esDelta(String mensaje) {
+        int inicio = mensaje.indexOf(CAMPO_DATOS);
+        if (inicio < 0 || inicio + CAMPO_DATOS.length() + 4 > mensaje.length()) {
+            return false;
+        }
+        inicio += CAMPO_DATOS.length();
+        try {
+            byte[] encabezado = Base64.getDecoder().decode(mensaje.substring(inicio, inicio + 4));
+            return encabezado.length > 1 && encabezado[1] == TRAMA_DELTA;
+        } catch (IllegalArgumentException e) {
+            return false;
+        }
+    }
+}
@@ -14,9 +14,13 @@ Cambios y Configuraciones del Proyecto3=================================
 package org.proyectosce.comunicaciones;
 
 import com.fasterxml.jackson.databind.ObjectMapper;
+import com.fasterxml.jackson.core.JsonFactory;
+import com.fasterxml.jackson.core.JsonParser;
 import com.fasterxml.jackson.core.JsonProcessingException;
+import com.fasterxml.jackson.core.JsonToken;
 import org.proyectosce.comandos.factory.CommandFactory;
 import org.proyectosce.comandos.factory.products.Command;
+import java.io.IOException;
 import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.List;
@@ -39,6 +43,7 @@ import java.util.Map;
         - crearMensajeSalida: Crea un mensaje JSON a partir de un comando y un objeto.
         - crearMensajeClientesLista: Genera un JSON con una lista de clientes a partir de IDs y nombres.
         - procesarComando: Procesa un mensaje JSON para generar y ejecutar un comando.
+        - leerTipoComando: Obtiene el campo "command" sin deserializar el mensaje completo.
 
     Example:
         JsonProcessor procesador = JsonProcessor.getInstance();
@@ -47,7 +52,10 @@ import java.util.Map;
 */
 public class JsonProcessor {
     private static JsonProcessor instance;
+    private static final String PREFIJO_COMANDO = "{\"command\":\"";
+
     private final ObjectMapper objectMapper = new ObjectMapper();
+    private final JsonFactory jsonFactory = objectMapper.getFactory();
 
     /* Function: JsonProcessor
         Constructor privado para la implementación del patrón Singleton.
@@ -143,6 +151,10 @@ public class JsonProcessor {
         Procesa un mensaje JSON, extrayendo el comando y delegando su ejecución
         a CommandFactory.
 
+        Sólo se lee el campo "command" (ver `leerTipoComando`). Los estados del juego, que son la mayoría de
+        los mensajes y los más grandes, se reenvían tal cual y nunca se convierten en objetos; los comandos
+        que necesitan sus datos (`tipoCliente`, `GameSpectator`, ...) los deserializan en CommandFactory.
+
         Params:
             - mensajeJson: String - Mensaje JSON que contiene el comando.
             - emisor: Cliente - Cliente que envió el mensaje.
@@ -152,11 +164,12 @@ public class JsonProcessor {
     */
     public Command procesarComando(String mensajeJson, Cliente emisor) {
         try {
-            // Deserializar el JSON a un mapa
-            Map<String, Object> jsonData = objectMapper.readValue(mensajeJson, Map.class);
-
-            // Obtener el comando del JSON
-            String commandType = (String) jsonData.get("command");
+            // Obtener el comando del JSON sin deserializarlo
+            String commandType = leerTipoComando(mensajeJson);
+            if (commandType == null) {
+                System.err.println("Mensaje sin campo \"command\" del cliente: " + emisor);
+                return null;
+            }
 
             // Construir parámetros para la creación del comando
             Map<String, Object> params = Map.of(
@@ -179,4 +192,49 @@ public class JsonProcessor {
 
         return null;
     }
+
+    /* Function: leerTipoComando
+        Obtiene el valor del campo "command" de primer nivel sin construir el mapa del mensaje.
+
+        Los clientes escriben "command" como primer campo y sin espacios, así que normalmente basta con
+        comparar el prefijo `{"command":"` y buscar la comilla de cierre. Si el mensaje tiene otro formato
+        se recorre con el parser en flujo de Jackson, saltando el contenido de los demás campos sin crear
+        objetos, y se detiene en cuanto encuentra "command".
+
+        Params:
+            - mensajeJson: String - Mensaje JSON completo.
+
+        Returns:
+            - String - Valor de "command", o null si el mensaje no lo tiene o no es un objeto.
+
+        Throws:
+            - IOException: Si el JSON está mal formado antes de llegar a "command".
+
+        Example:
+            leerTipoComando("{\"command\":\"sendGameState\",\"player\":{...}}"); // "sendGameState"
+    */
+    public String leerTipoComando(String mensajeJson) throws IOException {
+        if (mensajeJson.startsWith(PREFIJO_COMANDO)) {
+            int inicio = PREFIJO_COMANDO.length();
+            int fin = mensajeJson.indexOf('"', inicio);
+            if (fin > inicio && mensajeJson.lastIndexOf('\\', fin) < inicio) {
+                return mensajeJson.substring(inicio, fin);
+            }
+        }
+
+        try (JsonParser parser = jsonFactory.createParser(mensajeJson)) {
+            if (parser.nextToken() != JsonToken.START_OBJECT) {
+                return null;
+            }
+            while (parser.nextToken() == JsonToken.FIELD_NAME) {
+                String campo = parser.getCurrentName();
+                JsonToken valor = parser.nextToken();
+                if ("command".equals(campo)) {
+                    return valor == JsonToken.VALUE_STRING ? parser.getText() : null;
+                }
+                parser.skipChildren();
+            }
+        }
+        return null;
+    }
 }
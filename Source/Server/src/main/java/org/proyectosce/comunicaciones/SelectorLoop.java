@@ -0,0 +1,309 @@
+/*
+================================== LICENCIA =================
+=================================
+MIT License
+Copyright (c) 2024  José Bernardo Barquero Bonilla,
+                    Jose Eduardo Campos Salazar,
+                    Jimmy Feng Feng,
+                    Alexander Montero Vargas
+Consulta el archivo LICENSE para más detalles.
+=============================================================
+Cambios y Configuraciones del Proyecto3=================================
+*/
+
+package org.proyectosce.comunicaciones;
+
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.channels.CancelledKeyException;
+import java.nio.channels.ClosedSelectorException;
+import java.nio.channels.SelectionKey;
+import java.nio.channels.Selector;
+import java.nio.channels.ServerSocketChannel;
+import java.nio.channels.SocketChannel;
+import java.nio.charset.StandardCharsets;
+import java.util.Iterator;
+import java.util.Queue;
+import java.util.concurrent.ConcurrentLinkedQueue;
+
+/* Class: SelectorLoop
+    Hilo de eventos NIO que atiende a un grupo de clientes. Cada hilo tiene su propio `Selector` y se
+    encarga de aceptar conexiones (sólo el primero), leer y separar los mensajes por '\n' y escribir las
+    colas de salida de sus clientes cuando el canal lo permite.
+
+    Los demás hilos nunca tocan el selector directamente: registran tareas en `tareas` y despiertan al
+    hilo con `selector.wakeup()`.
+
+    Attributes:
+        - selector: Selector - Selector de los canales que atiende este hilo.
+        - tareas: Queue<Runnable> - Tareas pendientes enviadas desde otros hilos.
+        - socketServer: SocketServer - Servidor que recibe los mensajes completos y las desconexiones.
+        - hilo: Thread - Hilo que ejecuta el ciclo de eventos.
+
+    Methods:
+        - iniciar: Arranca el hilo.
+        - detener: Detiene el hilo y cierra el selector.
+        - registrarAceptador: Atiende las conexiones nuevas de un `ServerSocketChannel`.
+        - registrarCliente: Agrega un cliente aceptado a este hilo.
+        - solicitarEscritura: Pide vaciar la cola de salida de un cliente.
+
+    Example:
+        SelectorLoop loop = new SelectorLoop("selector-0", socketServer);
+        loop.iniciar();
+        loop.registrarCliente(cliente);
+*/
+public class SelectorLoop implements Runnable {
+    private static final int MAX_BUFFERS_POR_ESCRITURA = 16;
+    private static final int CAPACIDAD_MAXIMA_LECTURA = 1024 * 1024;  // Mensaje más grande aceptado
+
+    private final Selector selector;
+    private final Queue<Runnable> tareas = new ConcurrentLinkedQueue<>();
+    private final SocketServer socketServer;
+    private final Thread hilo;
+    private final ByteBuffer[] lote = new ByteBuffer[MAX_BUFFERS_POR_ESCRITURA];  // Sólo lo usa `hilo`
+    private volatile boolean activo = true;
+
+    /* Constructor: SelectorLoop
+        Abre el selector y prepara el hilo sin iniciarlo.
+
+        Params:
+            - nombre: String - Nombre del hilo.
+            - socketServer: SocketServer - Servidor que procesa los mensajes recibidos.
+
+        Throws:
+            - IOException: Si no se puede abrir el selector.
+    */
+    public SelectorLoop(String nombre, SocketServer socketServer) throws IOException {
+        this.selector = Selector.open();
+        this.socketServer = socketServer;
+        this.hilo = new Thread(this, nombre);
+    }
+
+    /* Function: iniciar
+        Arranca el hilo de eventos.
+    */
+    public void iniciar() {
+        hilo.start();
+    }
+
+    /* Function: detener
+        Detiene el hilo de eventos y cierra el selector.
+    */
+    public void detener() {
+        activo = false;
+        selector.wakeup();
+    }
+
+    /* Function: registrarAceptador
+        Registra el canal del servidor para aceptar conexiones en este hilo.
+
+        Params:
+            - canal: ServerSocketChannel - Canal del servidor, en modo no bloqueante.
+    */
+    public void registrarAceptador(ServerSocketChannel canal) {
+        ejecutar(() -> {
+            try {
+                canal.register(selector, SelectionKey.OP_ACCEPT);
+            } catch (IOException e) {
+                System.err.println("No se pudo registrar el canal del servidor: " + e.getMessage());
+            }
+        });
+    }
+
+    /* Function: registrarCliente
+        Agrega un cliente recién aceptado a este hilo para leer sus mensajes.
+
+        Params:
+            - cliente: Cliente - Cliente aceptado; su canal pasa a modo no bloqueante.
+    */
+    public void registrarCliente(Cliente cliente) {
+        cliente.setLoop(this);
+        ejecutar(() -> {
+            try {
+                SocketChannel canal = cliente.getChannel();
+                canal.configureBlocking(false);
+                cliente.setKey(canal.register(selector, SelectionKey.OP_READ, cliente));
+                vaciarCola(cliente);  // Mensajes encolados antes del registro
+            } catch (IOException e) {
+                socketServer.notificarCierre(cliente);
+            }
+        });
+    }
+
+    /* Function: solicitarEscritura
+        Pide al hilo que escriba la cola de salida del cliente. Si ya hay una solicitud pendiente no se
+        agrega otra.
+
+        Params:
+            - cliente: Cliente - Cliente con mensajes en cola.
+    */
+    public void solicitarEscritura(Cliente cliente) {
+        if (cliente.marcarEscrituraPendiente()) {
+            ejecutar(() -> vaciarCola(cliente));
+        }
+    }
+
+    /* Function: run
+        Ciclo de eventos: ejecuta las tareas pendientes y atiende los canales listos.
+    */
+    @Override
+    public void run() {
+        try {
+            while (activo) {
+                selector.select();
+                ejecutarTareas();
+
+                Iterator<SelectionKey> keys = selector.selectedKeys().iterator();
+                while (keys.hasNext()) {
+                    SelectionKey key = keys.next();
+                    keys.remove();
+                    atender(key);
+                }
+            }
+        } catch (IOException | ClosedSelectorException e) {
+            System.err.println("Error en el ciclo de eventos " + hilo.getName() + ": " + e.getMessage());
+        } finally {
+            cerrarSelector();
+        }
+    }
+
+    private void ejecutar(Runnable tarea) {
+        tareas.add(tarea);
+        selector.wakeup();
+    }
+
+    private void ejecutarTareas() {
+        Runnable tarea;
+        while ((tarea = tareas.poll()) != null) {
+            tarea.run();
+        }
+    }
+
+    private void atender(SelectionKey key) {
+        try {
+            if (!key.isValid()) {
+                return;
+            }
+            if (key.isAcceptable()) {
+                aceptar((ServerSocketChannel) key.channel());
+                return;
+            }
+
+            Cliente cliente = (Cliente) key.attachment();
+            if (key.isReadable()) {
+                leer(cliente);
+            }
+            if (key.isValid() && key.isWritable()) {
+                vaciarCola(cliente);
+            }
+        } catch (CancelledKeyException e) {
+            // El cliente se desconectó desde otro hilo mientras se atendía
+        }
+    }
+
+    private void aceptar(ServerSocketChannel canal) {
+        try {
+            SocketChannel clientChannel;
+            while ((clientChannel = canal.accept()) != null) {
+                socketServer.aceptarCliente(clientChannel);
+            }
+        } catch (IOException e) {
+            System.err.println("Error al aceptar cliente: " + e.getMessage());
+        }
+    }
+
+    /* Function: leer
+        Lee lo disponible en el canal y entrega cada línea completa al servidor. Los bytes de un mensaje
+        incompleto quedan en el buffer del cliente hasta la siguiente lectura.
+    */
+    private void leer(Cliente cliente) {
+        ByteBuffer buffer = cliente.getBufferLectura();
+        int bytesRead;
+        try {
+            bytesRead = cliente.getChannel().read(buffer);
+        } catch (IOException e) {
+            System.out.println("Fallo al recibir mensaje: " + e.getMessage());
+            socketServer.notificarCierre(cliente);
+            return;
+        }
+
+        if (bytesRead == -1) {
+            System.out.println("El cliente se ha desconectado: " + cliente);
+            socketServer.notificarCierre(cliente);
+            return;
+        }
+
+        // Procesar mensajes completos (separados por '\n')
+        buffer.flip();
+        byte[] datos = buffer.array();
+        int inicio = buffer.position();
+        for (int i = inicio; i < buffer.limit(); i++) {
+            if (datos[i] == '\n') {
+                String mensaje = new String(datos, inicio, i - inicio, StandardCharsets.UTF_8).trim();
+                inicio = i + 1;
+                if (!mensaje.isEmpty()) {
+                    socketServer.procesarMensaje(mensaje, cliente);
+                }
+            }
+        }
+        buffer.position(inicio);
+        buffer.compact();
+
+        // Un mensaje que no cabe en el buffer: ampliarlo o descartar al cliente si excede el máximo
+        if (!buffer.hasRemaining()) {
+            if (buffer.capacity() >= CAPACIDAD_MAXIMA_LECTURA) {
+                System.err.println("Mensaje demasiado grande del cliente: " + cliente);
+                socketServer.cerrarConexion(cliente);
+                return;
+            }
+            ByteBuffer ampliado = ByteBuffer.allocate(buffer.capacity() * 2);
+            buffer.flip();
+            ampliado.put(buffer);
+            cliente.setBufferLectura(ampliado);
+        }
+    }
+
+    /* Function: vaciarCola
+        Escribe la cola de salida del cliente con escrituras agrupadas. Si el canal no acepta todo, se activa
+        `OP_WRITE` y se continúa cuando el selector avise que se puede escribir. Nunca bloquea: un cliente lento
+        sólo acumula mensajes en su propia cola (ver `ColaSalida`).
+    */
+    private void vaciarCola(Cliente cliente) {
+        cliente.limpiarEscrituraPendiente();
+        SelectionKey key = cliente.getKey();
+        if (key == null || !key.isValid()) {
+            return;
+        }
+
+        ColaSalida cola = cliente.getColaSalida();
+        try {
+            while (true) {
+                int cantidad = cola.tomarLote(lote);
+                if (cantidad == 0) {
+                    key.interestOps(SelectionKey.OP_READ);
+                    return;
+                }
+
+                cliente.getChannel().write(lote, 0, cantidad);
+                boolean completo = !lote[cantidad - 1].hasRemaining();
+                cola.confirmarEscritura();
+                if (!completo) {
+                    // El socket está lleno: se sigue cuando avise OP_WRITE; mientras, la cola descarta estados viejos
+                    key.interestOps(SelectionKey.OP_READ | SelectionKey.OP_WRITE);
+                    return;
+                }
+            }
+        } catch (IOException | CancelledKeyException e) {
+            System.out.println("Fallo al enviar mensaje: " + e.getMessage());
+            socketServer.notificarCierre(cliente);
+        }
+    }
+
+    private void cerrarSelector() {
+        try {
+            selector.close();
+        } catch (IOException e) {
+            System.err.println("Error al cerrar el selector: " + e.getMessage());
+        }
+    }
+}
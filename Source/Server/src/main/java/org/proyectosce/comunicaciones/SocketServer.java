@@ -21,19 +21,30 @@ import java.io.IOException;
 import java.net.InetSocketAddress;
 import java.net.StandardSocketOptions;
 import java.nio.ByteBuffer;
+import java.nio.channels.SelectionKey;
 import java.nio.channels.ServerSocketChannel;
 import java.nio.channels.SocketChannel;
+import java.nio.charset.StandardCharsets;
 import java.util.Map;
 import java.util.Set;
 import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.Consumer;
 
 /* Class: SocketServer
     Clase Singleton que maneja las conexiones de clientes y la comunicación mediante mensajes.
 
+    Las conexiones se atienden con NIO no bloqueante: un grupo pequeño de hilos `SelectorLoop` (configurable
+    con `selectorThreads` en settings.ini) acepta, lee y escribe los canales de todos los clientes, en lugar
+    de un hilo bloqueado por cliente. El primer hilo también acepta las conexiones nuevas y las reparte entre
+    todos en turno rotativo.
+
     Attributes:
         - instance: SocketServer - Instancia única de la clase (Singleton).
         - serverSocketChannel: ServerSocketChannel - Canal del servidor para aceptar conexiones.
         - clientesActivos: Set<Cliente> - Conjunto de clientes conectados activamente.
+        - loops: SelectorLoop[] - Hilos de eventos que atienden a los clientes.
+        - alConectar: Consumer<Cliente> - Acción a ejecutar con cada cliente aceptado.
 
     Constructor:
         - SocketServer: Constructor privado para implementar el patrón Singleton.
@@ -41,24 +52,28 @@ import java.util.concurrent.ConcurrentHashMap;
     Methods:
         - getInstance: Retorna la instancia única de SocketServer.
         - abrirPuerto: Abre el puerto para escuchar conexiones.
-        - esperarCliente: Espera y acepta conexiones entrantes de clientes.
-        - enviarMensaje: Envía un mensaje a un cliente específico.
-        - recibirMensaje: Recibe un mensaje de un cliente conectado.
+        - iniciar: Abre el puerto e inicia los hilos de eventos.
+        - enviarMensaje: Encola un mensaje para un cliente específico.
+        - codificarMensaje: Codifica un mensaje una sola vez para enviarlo a varios clientes.
+        - enviarEstadoJuego: Encola un estado del juego, que puede descartarse si el cliente va atrasado.
         - cerrarConexion: Cierra la conexión con un cliente.
-        - notificarDesconexion: Maneja la desconexión de un cliente.
         - manejarExcepcion: Maneja excepciones y muestra mensajes de error.
 
     Example:
         SocketServer servidor = SocketServer.getInstance();
-        servidor.abrirPuerto();
-        Cliente cliente = servidor.esperarCliente();
+        servidor.iniciar(cliente -> System.out.println("Nuevo cliente"));
         servidor.enviarMensaje(cliente, "Bienvenido al servidor.");
 */
 public class SocketServer {
+    private static final int MAX_HILOS_SELECTOR = 4;
+
     private static SocketServer instance;
     private final JsonProcessor jsonProcessor = JsonProcessor.getInstance();
     private ServerSocketChannel serverSocketChannel;
     private final Set<Cliente> clientesActivos = ConcurrentHashMap.newKeySet();
+    private SelectorLoop[] loops = new SelectorLoop[0];
+    private final AtomicInteger siguienteLoop = new AtomicInteger();
+    private volatile Consumer<Cliente> alConectar = cliente -> {};
 
     /* Function: SocketServer
         Constructor privado para la implementación del patrón Singleton.
@@ -79,6 +94,7 @@ public class SocketServer {
 
     /* Function: abrirPuerto
         Configura el servidor para escuchar nuevas conexiones en la dirección y puerto especificados.
+        El canal queda en modo no bloqueante para registrarlo en un selector.
     */
     public void abrirPuerto() {
         try {
@@ -89,100 +105,143 @@ public class SocketServer {
             serverSocketChannel = ServerSocketChannel.open();
             serverSocketChannel.setOption(StandardSocketOptions.SO_REUSEADDR, true);
             serverSocketChannel.bind(new InetSocketAddress(address, port));
-            serverSocketChannel.configureBlocking(true);
+            serverSocketChannel.configureBlocking(false);
             System.out.println("Servidor escuchando en " + address + ":" + port);
         } catch (IOException e) {
             manejarExcepcion("No se pudo abrir el puerto del servidor", e);
         }
     }
 
-    /* Function: esperarCliente
-        Acepta la conexión de un cliente y lo añade a la lista de clientes activos.
+    /* Function: iniciar
+        Abre el puerto e inicia los hilos de eventos. No bloquea: retorna en cuanto los hilos están corriendo.
 
-        Returns:
-            - Cliente - Objeto Cliente conectado, o null si hubo un error.
+        Params:
+            - alConectar: Consumer<Cliente> - Se ejecuta con cada cliente aceptado, desde un hilo de eventos.
+
+        Restriction:
+            - Debe llamarse una sola vez.
     */
-    public Cliente esperarCliente() {
+    public synchronized void iniciar(Consumer<Cliente> alConectar) {
+        this.alConectar = alConectar;
+        abrirPuerto();
+        if (serverSocketChannel == null || !serverSocketChannel.isOpen()) {
+            return;
+        }
+
+        int cantidad = cantidadHilosSelector();
         try {
-            SocketChannel clientChannel = serverSocketChannel.accept();
-            Cliente nuevoCliente = new Cliente(clientChannel);
-            clientesActivos.add(nuevoCliente);
-            System.out.println("Cliente conectado desde: " + clientChannel.getRemoteAddress());
-            return nuevoCliente;
+            loops = new SelectorLoop[cantidad];
+            for (int i = 0; i < cantidad; i++) {
+                loops[i] = new SelectorLoop("selector-" + i, this);
+            }
         } catch (IOException e) {
-            manejarExcepcion("Error al aceptar cliente", e);
-            return null;
+            manejarExcepcion("No se pudieron crear los selectores", e);
+            return;
         }
+
+        loops[0].registrarAceptador(serverSocketChannel);
+        for (SelectorLoop loop : loops) {
+            loop.iniciar();
+        }
+        System.out.println("Atendiendo clientes con " + cantidad + " hilo(s) de eventos");
+    }
+
+    // Valor de settings.ini o, si no está, un hilo por núcleo hasta MAX_HILOS_SELECTOR
+    private int cantidadHilosSelector() {
+        int configurados = SettingsReader.getInstance().getSelectorThreads();
+        if (configurados > 0) {
+            return configurados;
+        }
+        return Math.max(1, Math.min(MAX_HILOS_SELECTOR, Runtime.getRuntime().availableProcessors()));
+    }
+
+    /* Function: aceptarCliente
+        Crea el cliente de un canal recién aceptado y lo asigna a uno de los hilos de eventos.
+
+        Params:
+            - clientChannel: SocketChannel - Canal aceptado.
+    */
+    void aceptarCliente(SocketChannel clientChannel) throws IOException {
+        clientChannel.setOption(StandardSocketOptions.TCP_NODELAY, true);
+        Cliente nuevoCliente = new Cliente(clientChannel);
+        clientesActivos.add(nuevoCliente);
+
+        SelectorLoop loop = loops[Math.floorMod(siguienteLoop.getAndIncrement(), loops.length)];
+        loop.registrarCliente(nuevoCliente);
+        alConectar.accept(nuevoCliente);
+        System.out.println("Cliente conectado desde: " + clientChannel.getRemoteAddress());
     }
 
     /* Function: enviarMensaje
-        Envía un mensaje a un cliente específico.
+        Encola un mensaje, seguido del delimitador '\n', para un cliente específico. La escritura la hace el hilo
+        de eventos del cliente, así que este método no bloquea aunque el cliente lea lento.
 
         Params:
             - cliente: Cliente - Cliente al que se envía el mensaje.
             - mensaje: String - Mensaje a enviar.
     */
     public void enviarMensaje(Cliente cliente, String mensaje) {
-        try {
-            ByteBuffer buffer = ByteBuffer.wrap(mensaje.getBytes());
-            cliente.getChannel().write(buffer);
-        } catch (IOException e) {
-            manejarExcepcion("Fallo al enviar mensaje", e);
+        byte[] bytes = (mensaje + "\n").getBytes(StandardCharsets.UTF_8);
+        cliente.encolar(ByteBuffer.wrap(bytes));
+
+        SelectorLoop loop = cliente.getLoop();
+        if (loop != null) {
+            loop.solicitarEscritura(cliente);
         }
     }
 
-    /* Function: recibirMensaje
-        Recibe un mensaje de un cliente conectado.
+    /* Function: codificarMensaje
+        Convierte un mensaje, seguido del delimitador '\n', en un buffer directo de sólo lectura que se puede
+        compartir entre varios clientes con `ByteBuffer.duplicate()`.
 
         Params:
-            - cliente: Cliente - Cliente del que se recibe el mensaje.
+            - mensaje: String - Mensaje a codificar.
 
         Returns:
-            - Void - no retorna nada
-    */
-    public void recibirMensajes(Cliente cliente) {
-        try {
-            ByteBuffer buffer = ByteBuffer.allocate(8192);
-            StringBuilder mensajeAcumulado = new StringBuilder();
-
-            while (true) {
-                int bytesRead = cliente.getChannel().read(buffer);
+            - ByteBuffer - Buffer directo de sólo lectura, listo para escribir.
 
-                if (bytesRead == -1) {
-                    System.out.println("El cliente se ha desconectado: " + cliente);
-                    ejecutarDisconnectCommand(cliente);
-                    break;
-                }
-
-                buffer.flip();
+        Example:
+            ByteBuffer estado = socketServer.codificarMensaje(gameStateJson);
+            for (Cliente espectador : observadores) {
+                socketServer.enviarEstadoJuego(espectador, estado, false);
+            }
+    */
+    public ByteBuffer codificarMensaje(String mensaje) {
+        byte[] bytes = mensaje.getBytes(StandardCharsets.UTF_8);
+        ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length + 1);
+        buffer.put(bytes).put((byte) '\n').flip();
+        return buffer.asReadOnlyBuffer();
+    }
 
-                // Convertir el buffer en texto y agregarlo al acumulador
-                mensajeAcumulado.append(new String(buffer.array(), 0, bytesRead));
-                buffer.clear();
+    /* Function: enviarEstadoJuego
+        Encola un estado del juego ya codificado para un cliente. A diferencia de `enviarMensaje`, si el cliente
+        ya tiene varios estados sin escribir se descarta el más viejo: un espectador lento recibe menos cuadros
+        pero no retrasa al jugador ni a los demás observadores. Un keyframe no se descarta mientras haya deltas
+        que dependan de él y no haya otro más nuevo (ver `ColaSalida`).
 
-                // Procesar mensajes completos (separados por '\n')
-                while (mensajeAcumulado.indexOf("\n") != -1) {
-                    int finDeMensaje = mensajeAcumulado.indexOf("\n");
-                    String mensajeCompleto = mensajeAcumulado.substring(0, finDeMensaje).trim();
-                    mensajeAcumulado.delete(0, finDeMensaje + 1);
+        Params:
+            - cliente: Cliente - Espectador al que se envía el estado.
+            - estado: ByteBuffer - Estado codificado con `codificarMensaje`. No se modifica: cada cliente recibe
+              su propio `duplicate()` con posición independiente sobre los mismos bytes.
+            - delta: boolean - `true` si es una trama delta (`InstantaneaJugador.esDelta`).
+    */
+    public void enviarEstadoJuego(Cliente cliente, ByteBuffer estado, boolean delta) {
+        cliente.encolarEstado(estado.duplicate(), delta);
 
-                    // Procesar el mensaje como JSON
-                    procesarMensajeJson(mensajeCompleto, cliente);
-                }
-            }
-        } catch (IOException e) {
-            System.out.println("Fallo al recibir mensaje: " + e.getMessage());
-            ejecutarDisconnectCommand(cliente);
+        SelectorLoop loop = cliente.getLoop();
+        if (loop != null) {
+            loop.solicitarEscritura(cliente);
         }
     }
 
+    /* Function: procesarMensaje
+        Procesa un mensaje JSON completo recibido de un cliente. Lo llama el hilo de eventos del cliente.
 
-    /**
-     * Procesa un mensaje JSON recibido de un cliente.
-     * @param mensaje El mensaje recibido en formato JSON.
-     * @param cliente El cliente que envió el mensaje.
-     */
-    private void procesarMensajeJson(String mensaje, Cliente cliente) {
+        Params:
+            - mensaje: String - El mensaje recibido en formato JSON, sin el delimitador.
+            - cliente: Cliente - El cliente que envió el mensaje.
+    */
+    void procesarMensaje(String mensaje, Cliente cliente) {
         try {
             // Procesar el mensaje JSON y convertirlo en un comando ejecutable
             Command comando = jsonProcessor.procesarComando(mensaje, cliente);
@@ -201,6 +260,31 @@ public class SocketServer {
         }
     }
 
+    /* Function: notificarCierre
+        Cierra el canal de un cliente que se desconectó o falló y ejecuta el comando de desconexión.
+        Llamarla varias veces con el mismo cliente sólo tiene efecto la primera.
+
+        Params:
+            - cliente: Cliente - Cliente desconectado.
+    */
+    void notificarCierre(Cliente cliente) {
+        if (cliente == null || !clientesActivos.remove(cliente)) {
+            return;
+        }
+
+        SelectionKey key = cliente.getKey();
+        if (key != null) {
+            key.cancel();
+        }
+        try {
+            cliente.getChannel().close();
+        } catch (IOException e) {
+            manejarExcepcion("Error al cerrar la conexión del cliente", e);
+        }
+        ejecutarDisconnectCommand(cliente);
+        System.out.println("Cliente desconectado: " + cliente);
+    }
+
     /**
      * Ejecuta el comando de desconexión para un cliente específico.
      * @param cliente El cliente que se desconectó.
@@ -223,8 +307,6 @@ public class SocketServer {
         disconnectCommand.ejecutar();
     }
 
-
-
     /* Function: cerrarConexion
         Cierra la conexión de un cliente.
 
@@ -232,36 +314,10 @@ public class SocketServer {
             - cliente: Cliente - Cliente a desconectar.
     */
     public void cerrarConexion(Cliente cliente) {
-        try {
-            if (cliente != null && cliente.getChannel().isOpen()) {
-                cliente.getChannel().close();
-                System.out.println("Conexión cerrada con el cliente: " + cliente.getChannel().getRemoteAddress());
-            }
-            notificarDesconexion(cliente);
-        } catch (IOException e) {
-            manejarExcepcion("Error al cerrar la conexión del cliente", e);
-        }
-    }
-
-    /* Function: notificarDesconexion
-        Notifica y maneja la desconexión de un cliente.
-
-        Params:
-            - cliente: Cliente - Cliente desconectado.
-    */
-    private void notificarDesconexion(Cliente cliente) {
-        if (cliente != null) {
-            clientesActivos.remove(cliente);
-            CommandFactory commandFactory = CommandFactory.getInstance();
-            Map<String, Object> params = Map.of(
-                    "cliente", cliente,
-                    "comServer", ComServer.getInstance(),
-                    "socketServer", SocketServer.getInstance()
-            );
-            Command disconnectCommand = commandFactory.crearComando("disconnect", params);
-            disconnectCommand.ejecutar();
-            System.out.println("Cliente desconectado: " + cliente);
+        if (cliente != null && cliente.getChannel().isOpen()) {
+            System.out.println("Cerrando conexión con el cliente: " + cliente);
         }
+        notificarCierre(cliente);
     }
 
     /* Function: manejarExcepcion
@@ -0,0 +1,100 @@
+package org.proyectosce.comunicaciones;
+
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+public class ColaSalidaTest {
+
+    private static ByteBuffer mensaje(String texto) {
+        return ByteBuffer.wrap(texto.getBytes(StandardCharsets.UTF_8));
+    }
+
+    private static String contenido(ByteBuffer buffer) {
+        return StandardCharsets.UTF_8.decode(buffer.duplicate()).toString();
+    }
+
+    @Test
+    public void testDescartaEstadoMasViejo() {
+        ColaSalida cola = new ColaSalida(2);
+        cola.agregarEstado(mensaje("e1"));
+        cola.agregarControl(mensaje("c1"));
+        cola.agregarEstado(mensaje("e2"));
+        assertTrue(cola.agregarEstado(mensaje("e3")));
+
+        ByteBuffer[] lote = new ByteBuffer[8];
+        assertEquals(3, cola.tomarLote(lote));
+        assertEquals("c1", contenido(lote[0]));
+        assertEquals("e2", contenido(lote[1]));
+        assertEquals("e3", contenido(lote[2]));
+        assertEquals(1, cola.getDescartados());
+    }
+
+    @Test
+    public void testNuncaDescartaControl() {
+        ColaSalida cola = new ColaSalida(1);
+        for (int i = 0; i < 100; i++) {
+            cola.agregarControl(mensaje("c" + i));
+        }
+        cola.agregarEstado(mensaje("e1"));
+        cola.agregarEstado(mensaje("e2"));
+
+        ByteBuffer[] lote = new ByteBuffer[128];
+        assertEquals(101, cola.tomarLote(lote));
+        assertEquals("e2", contenido(lote[100]));
+    }
+
+    @Test
+    public void testNoDescartaMensajeEnVuelo() {
+        ColaSalida cola = new ColaSalida(1);
+        cola.agregarEstado(mensaje("e1"));
+
+        ByteBuffer[] lote = new ByteBuffer[8];
+        assertEquals(1, cola.tomarLote(lote));
+        lote[0].position(1);  // Escrito a medias
+
+        assertFalse(cola.agregarEstado(mensaje("e2")));
+        assertTrue(cola.agregarEstado(mensaje("e3")));  // Descarta e2, no e1
+
+        assertFalse(cola.confirmarEscritura());
+        assertEquals(2, cola.tomarLote(lote));
+        assertEquals("1", contenido(lote[0]));
+        assertEquals("e3", contenido(lote[1]));
+    }
+
+    @Test
+    public void testConservaKeyframeDelQueDependenDeltas() {
+        ColaSalida cola = new ColaSalida(3);
+        cola.agregarEstado(mensaje("k"), false);
+        cola.agregarEstado(mensaje("d1"), true);
+        cola.agregarEstado(mensaje("d2"), true);
+        assertTrue(cola.agregarEstado(mensaje("d3"), true));
+
+        ByteBuffer[] lote = new ByteBuffer[8];
+        assertEquals(3, cola.tomarLote(lote));
+        assertEquals("k", contenido(lote[0]));
+        assertEquals("d2", contenido(lote[1]));
+        assertEquals("d3", contenido(lote[2]));
+    }
+
+    @Test
+    public void testKeyframeNuevoDescartaElAnteriorYSusDeltas() {
+        ColaSalida cola = new ColaSalida(3);
+        cola.agregarEstado(mensaje("k1"), false);
+        cola.agregarControl(mensaje("c1"));
+        cola.agregarEstado(mensaje("d1"), true);
+        cola.agregarEstado(mensaje("d2"), true);
+        assertTrue(cola.agregarEstado(mensaje("k2"), false));
+
+        ByteBuffer[] lote = new ByteBuffer[8];
+        assertEquals(2, cola.tomarLote(lote));
+        assertEquals("c1", contenido(lote[0]));
+        assertEquals("k2", contenido(lote[1]));
+        assertEquals(3, cola.getDescartados());
+    }
+}
@@ -0,0 +1,66 @@
+package org.proyectosce.comunicaciones;
+
+import org.junit.Test;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertSame;
+import static org.junit.Assert.assertTrue;
+
+public class ComServerTest {
+
+    private final ComServer comServer = ComServer.getInstance();
+
+    @Test
+    public void testObtenerClientePorId() {
+        Cliente jugador = new Cliente(null);
+        comServer.registrarJugador(jugador);
+        assertSame(jugador, comServer.obtenerClientePorId(jugador.getId()));
+
+        comServer.eliminarCliente(jugador);
+        assertNull(comServer.obtenerClientePorId(jugador.getId()));
+        assertNull(comServer.obtenerClientePorId(null));
+    }
+
+    @Test
+    public void testEspectadorCambiaDeJugador() {
+        Cliente primero = new Cliente(null);
+        Cliente segundo = new Cliente(null);
+        Cliente espectador = new Cliente(null);
+        comServer.registrarJugador(primero);
+        comServer.registrarJugador(segundo);
+
+        comServer.registrarObservador(primero, espectador);
+        comServer.registrarObservador(segundo, espectador);
+        assertFalse(comServer.obtenerObservadores(primero).contains(espectador));
+        assertTrue(comServer.obtenerObservadores(segundo).contains(espectador));
+
+        comServer.eliminarEspectador(espectador);
+        assertTrue(comServer.obtenerObservadores(segundo).isEmpty());
+
+        comServer.eliminarCliente(primero);
+        comServer.eliminarCliente(segundo);
+    }
+
+    @Test
+    public void testJugadorDesconectadoLiberaEspectadores() {
+        Cliente jugador = new Cliente(null);
+        Cliente otro = new Cliente(null);
+        Cliente espectador = new Cliente(null);
+        comServer.registrarJugador(jugador);
+        comServer.registrarJugador(otro);
+        comServer.registrarObservador(jugador, espectador);
+
+        comServer.eliminarObservadores(jugador);
+        comServer.eliminarCliente(jugador);
+        assertEquals(0, comServer.obtenerObservadores(jugador).size());
+
+        // Ya no observa a nadie: registrarse con otro jugador no deja restos del anterior
+        comServer.registrarObservador(otro, espectador);
+        comServer.eliminarEspectador(espectador);
+        assertTrue(comServer.obtenerObservadores(otro).isEmpty());
+
+        comServer.eliminarCliente(otro);
+    }
+}
@@ -0,0 +1,69 @@
+package org.proyectosce.comunicaciones;
+
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.Base64;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
+
+public class InstantaneaJugadorTest {
+
+    // Mensaje "sendGameStateBin" con un encabezado de 12 bytes del tipo indicado
+    private static String trama(int tipo, int seq) {
+        byte[] encabezado = new byte[12];
+        encabezado[0] = 1;
+        encabezado[1] = (byte) tipo;
+        encabezado[2] = (byte) seq;
+        return "{\"command\":\"sendGameStateBin\",\"data\":\""
+                + Base64.getEncoder().encodeToString(encabezado) + "\"}";
+    }
+
+    private static ByteBuffer mensaje(String texto) {
+        return ByteBuffer.wrap(texto.getBytes(StandardCharsets.UTF_8));
+    }
+
+    @Test
+    public void testEsDelta() {
+        assertFalse(InstantaneaJugador.esDelta(trama(1, 0)));
+        assertTrue(InstantaneaJugador.esDelta(trama(2, 1)));
+        assertFalse(InstantaneaJugador.esDelta("{\"command\":\"sendGameState\",\"player\":{}}"));
+        assertFalse(InstantaneaJugador.esDelta("{\"command\":\"sendGameStateBin\",\"data\":\"A\"}"));
+    }
+
+    @Test
+    public void testGuardaKeyframeYUltimoDelta() {
+        InstantaneaJugador instantanea = new InstantaneaJugador();
+        ByteBuffer keyframe = mensaje("k");
+        ByteBuffer delta = mensaje("d2");
+
+        instantanea.actualizar(trama(2, 0), mensaje("d0"));  // Sin keyframe previo no sirve
+        assertNull(instantanea.getCompleto());
+        assertNull(instantanea.getDelta());
+
+        instantanea.actualizar(trama(1, 1), keyframe);
+        instantanea.actualizar(trama(2, 2), mensaje("d1"));
+        instantanea.actualizar(trama(2, 3), delta);
+        assertEquals(keyframe, instantanea.getCompleto());
+        assertEquals(delta, instantanea.getDelta());
+
+        ByteBuffer siguiente = mensaje("k2");
+        instantanea.actualizar(trama(1, 4), siguiente);
+        assertEquals(siguiente, instantanea.getCompleto());
+        assertNull(instantanea.getDelta());
+    }
+
+    @Test
+    public void testEstadoJsonReemplazaAlAnterior() {
+        InstantaneaJugador instantanea = new InstantaneaJugador();
+        ByteBuffer ultimo = mensaje("e2");
+        instantanea.actualizar("{\"command\":\"sendGameState\"}", mensaje("e1"));
+        instantanea.actualizar("{\"command\":\"sendGameState\"}", ultimo);
+        assertEquals(ultimo, instantanea.getCompleto());
+        assertNull(instantanea.getDelta());
+    }
+}
@@ -0,0 +1,33 @@
+package org.proyectosce.comunicaciones;
+
+import org.junit.Test;
+
+import java.io.IOException;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNull;
+
+public class JsonProcessorTest {
+
+    private final JsonProcessor jsonProcessor = JsonProcessor.getInstance();
+
+    @Test
+    public void testLeerTipoComandoPrefijo() throws IOException {
+        assertEquals("sendGameState",
+                jsonProcessor.leerTipoComando("{\"command\":\"sendGameState\",\"player\":{\"positionX\":1}}"));
+        assertEquals("sendGameStateBin",
+                jsonProcessor.leerTipoComando("{\"command\":\"sendGameStateBin\",\"data\":\"AAEC\"}"));
+    }
+
+    @Test
+    public void testLeerTipoComandoFueraDeOrden() throws IOException {
+        String json = "{\n\t\"tipoCliente\":\t\"jugador\",\n\t\"data\": {\"command\": \"no\"},\n\t\"command\":\t\"tipoCliente\"\n}";
+        assertEquals("tipoCliente", jsonProcessor.leerTipoComando(json));
+    }
+
+    @Test
+    public void testLeerTipoComandoSinCampo() throws IOException {
+        assertNull(jsonProcessor.leerTipoComando("{\"jugadorId\":\"123\"}"));
+        assertNull(jsonProcessor.leerTipoComando("[1,2,3]"));
+    }
+}